@@ -0,0 +1,98 @@
+#!/bin/sh
+# Benchmark del compilador: genera programas de varios tamaños, los compila con
+# --time-report=json y escribe el tiempo y el rendimiento (tokens/s y lineas/s)
+# de cada fase. Los resultados se agregan a resultados_compilador.csv para
+# compararlos despues de cada cambio.
+#
+# Uso: ./compilador.sh
+# Variables: TAMANOS="100 1000 5000" (variables del programa), LISTAS=10,
+#            PROFUNDIDAD=6, TERMINOS=8, CFLAGS="-O2" (para compilar el compilador),
+#            LOTE=0 (si es mayor, tambien compara compilar LOTE programas uno por
+#            uno contra compilarlos juntos con -j HILOS), HILOS=$(nproc)
+
+set -e
+
+DIR=$(cd "$(dirname "$0")" && pwd)
+RAIZ=$(dirname "$DIR")
+TAMANOS=${TAMANOS:-"100 1000 5000"}
+LISTAS=${LISTAS:-10}
+PROFUNDIDAD=${PROFUNDIDAD:-6}
+TERMINOS=${TERMINOS:-8}
+LOTE=${LOTE:-0}
+HILOS=${HILOS:-$(nproc 2>/dev/null || echo 1)}
+CFLAGS=${CFLAGS:-"-O2"}
+RESULTADOS="$DIR/resultados_compilador.csv"
+
+TEMP=$(mktemp -d)
+trap 'rm -rf "$TEMP"' EXIT
+
+gcc $CFLAGS -w "$RAIZ"/Compilador/*.c -o "$TEMP/wwe" -pthread
+gcc $CFLAGS "$DIR/generador.c" -o "$TEMP/generador"
+cp "$RAIZ/Ejemplos/Listas.c" "$RAIZ/Ejemplos/Listas.h" "$TEMP/"
+
+COMMIT=$(git -C "$RAIZ" rev-parse --short HEAD 2>/dev/null || echo "sin-git")
+FECHA=$(date +%Y-%m-%dT%H:%M:%S)
+
+if [ ! -f "$RESULTADOS" ]; then
+    echo "fecha,commit,variables,lineas,tokens,lexico_s,sintactico_s,enunciados_s,backend_s,gcc_s" > "$RESULTADOS"
+fi
+
+# Saca el tiempo de reloj de una fase del JSON del reporte
+pared() {
+    sed -n "s/.*\"fase\":\"$1\",\"pared\":\([0-9.e+-]*\).*/\1/p" "$TEMP/reporte.json"
+}
+
+printf "%-9s %8s %9s  %-12s %10s %14s %14s\n" "Variables" "Lineas" "Tokens" "Fase" "Segundos" "Tokens/s" "Lineas/s"
+
+for TAMANO in $TAMANOS; do
+    BLOQUES=$((TAMANO / 10 + 1))
+    "$TEMP/generador" -v "$TAMANO" -l "$LISTAS" -p "$PROFUNDIDAD" -e "$TERMINOS" -b "$BLOQUES" -o "$TEMP/programa.wwe"
+    LINEAS=$(wc -l < "$TEMP/programa.wwe")
+
+    (cd "$TEMP" && ./wwe programa.wwe -o programa --time-report=json > /dev/null 2> reporte.json)
+    TOKENS=$(sed -n 's/.*"tokens":\([0-9]*\).*/\1/p' "$TEMP/reporte.json")
+
+    LEXICO=$(pared lexico)
+    SINTACTICO=$(pared sintactico)
+    ENUNCIADOS=$(pared enunciados)
+    BACKEND=$(awk "BEGIN { print $(pared optimizacion) + $(pared traduccion) }")
+    GCC=$(pared gcc)
+
+    for FASE in lexico sintactico enunciados backend gcc; do
+        case $FASE in
+            lexico) T=$LEXICO ;;
+            sintactico) T=$SINTACTICO ;;
+            enunciados) T=$ENUNCIADOS ;;
+            backend) T=$BACKEND ;;
+            gcc) T=$GCC ;;
+        esac
+        awk -v v="$TAMANO" -v l="$LINEAS" -v k="$TOKENS" -v f="$FASE" -v t="$T" 'BEGIN {
+            if(t <= 0) t = 1e-9
+            printf "%-9s %8d %9d  %-12s %10.6f %14.0f %14.0f\n", v, l, k, f, t, k / t, l / t
+        }'
+    done
+
+    echo "$FECHA,$COMMIT,$TAMANO,$LINEAS,$TOKENS,$LEXICO,$SINTACTICO,$ENUNCIADOS,$BACKEND,$GCC" >> "$RESULTADOS"
+done
+
+echo "Resultados agregados a $RESULTADOS"
+
+if [ "$LOTE" -gt 0 ]; then
+    mkdir -p "$TEMP/lote/serie" "$TEMP/lote/paralelo"
+    for I in $(seq 1 "$LOTE"); do
+        "$TEMP/generador" -v 100 -l "$LISTAS" -p "$PROFUNDIDAD" -e "$TERMINOS" -b 11 -o "$TEMP/lote/p$I.wwe"
+    done
+    cp "$TEMP/Listas.c" "$TEMP/Listas.h" "$TEMP/lote/"
+
+    INICIO=$(date +%s.%N)
+    (cd "$TEMP/lote" && for F in p*.wwe; do ../wwe "$F" -o "serie/${F%.wwe}" > /dev/null; done)
+    SERIE=$(awk "BEGIN { print $(date +%s.%N) - $INICIO }")
+
+    INICIO=$(date +%s.%N)
+    (cd "$TEMP/lote" && ../wwe -j "$HILOS" p*.wwe -o paralelo > /dev/null)
+    PARALELO=$(awk "BEGIN { print $(date +%s.%N) - $INICIO }")
+
+    awk -v n="$LOTE" -v h="$HILOS" -v s="$SERIE" -v p="$PARALELO" 'BEGIN {
+        printf "\nLote de %d programas: uno por uno %.3f s, con -j %d %.3f s (%.2fx)\n", n, s, h, p, s / p
+    }'
+fi
@@ -0,0 +1,77 @@
+#!/bin/sh
+# Benchmark de los programas generados: compila los kernels de kernels/ con cada
+# tipo de numero y opcion del compilador, los corre con entrada generada y
+# escribe los nanosegundos por elemento y las instrucciones retiradas. La version
+# en C escrita a mano de cada kernel se mide igual como referencia. Los resultados
+# se agregan a resultados_ejecucion.csv.
+#
+# Uso: ./ejecucion.sh
+# Variables: ESCALA=1 (multiplica los elementos de cada kernel),
+#            BANDERAS (opciones a probar separadas por ';'), CFLAGS="-O2"
+
+set -e
+
+DIR=$(cd "$(dirname "$0")" && pwd)
+RAIZ=$(dirname "$DIR")
+ESCALA=${ESCALA:-1}
+CFLAGS=${CFLAGS:-"-O2"}
+BANDERAS=${BANDERAS:-";--numeric double;--numeric int64;--checked;--sort-idioms;--parallel"}
+RESULTADOS="$DIR/resultados_ejecucion.csv"
+
+TEMP=$(mktemp -d)
+trap 'rm -rf "$TEMP"' EXIT
+
+gcc $CFLAGS -w "$RAIZ"/Compilador/*.c -o "$TEMP/wwe" -pthread
+gcc $CFLAGS "$DIR/medir.c" -o "$TEMP/medir"
+cp "$RAIZ/Ejemplos/Listas.c" "$RAIZ/Ejemplos/Listas.h" "$TEMP/"
+
+COMMIT=$(git -C "$RAIZ" rev-parse --short HEAD 2>/dev/null || echo "sin-git")
+FECHA=$(date +%Y-%m-%dT%H:%M:%S)
+
+if [ ! -f "$RESULTADOS" ]; then
+    echo "fecha,commit,kernel,banderas,elementos,ns,ns_por_elemento,instrucciones" > "$RESULTADOS"
+fi
+
+# Escribe la entrada de un kernel con la cantidad de elementos dada
+entrada() {
+    case $1 in
+        burbuja) awk -v n="$2" 'BEGIN { srand(1); print n; for(i = 0; i < n; i++) print int(rand() * 1000000) }' ;;
+        suma) awk -v n="$2" 'BEGIN { srand(1); for(i = 0; i < n; i++) printf "%.2f\n", rand() * 1000 }' ;;
+        *) echo "$2" ;;
+    esac
+}
+
+# Mide un programa y escribe su renglon en la tabla y el CSV
+medir() {
+    KERNEL=$1; NOMBRE=$2; N=$3; PROGRAMA=$4
+    RESULTADO=$("$TEMP/medir" "$TEMP/$KERNEL.txt" "$PROGRAMA") || { echo "$KERNEL [$NOMBRE] fallo"; return; }
+    NS=${RESULTADO% *}
+    INSTRUCCIONES=${RESULTADO#* }
+    awk -v k="$KERNEL" -v b="$NOMBRE" -v n="$N" -v ns="$NS" -v ins="$INSTRUCCIONES" 'BEGIN {
+        printf "%-10s %-18s %9d %12.3f %12.2f %16s\n", k, b, n, ns / 1e6, ns / n, ins < 0 ? "n/d" : ins
+    }'
+    echo "$FECHA,$COMMIT,$KERNEL,$NOMBRE,$N,$NS,$(awk "BEGIN { print $NS / $N }"),$INSTRUCCIONES" >> "$RESULTADOS"
+}
+
+printf "%-10s %-18s %9s %12s %12s %16s\n" "Kernel" "Banderas" "Elementos" "ms" "ns/elemento" "Instrucciones"
+
+for KERNEL in burbuja fibonacci fizzbuzz suma; do
+    case $KERNEL in
+        burbuja) N=$((3000 * ESCALA)) ;;
+        fibonacci) N=$((10000000 * ESCALA)) ;;
+        fizzbuzz) N=$((1000000 * ESCALA)) ;;
+        suma) N=$((1000000 * ESCALA)) ;;
+    esac
+    entrada $KERNEL $N > "$TEMP/$KERNEL.txt"
+    cp "$DIR/kernels/$KERNEL.wwe" "$TEMP/"
+
+    gcc -O3 "$DIR/kernels/$KERNEL.c" -o "$TEMP/${KERNEL}_c"
+    medir $KERNEL "C a mano" $N "$TEMP/${KERNEL}_c"
+
+    echo "$BANDERAS" | tr ';' '\n' | while read -r OPCIONES; do
+        (cd "$TEMP" && ./wwe $KERNEL.wwe -o ${KERNEL}_wwe $OPCIONES > /dev/null) || { echo "$KERNEL [$OPCIONES] no compilo"; continue; }
+        medir $KERNEL "${OPCIONES:-float}" $N "$TEMP/${KERNEL}_wwe"
+    done
+done
+
+echo "Resultados agregados a $RESULTADOS"
@@ -0,0 +1,196 @@
+/**
+ * @file generador.c
+ * @brief Generador de programas WWE grandes para medir el compilador.
+ *
+ * Escribe un programa valido con la cantidad de variables, listas, expresiones
+ * y ciclos anidados que se pidan, para ver como crece el tiempo de cada fase
+ * del compilador con el tamaño del programa.
+ *
+ * Uso: generador [-v variables] [-l listas] [-p profundidad] [-e terminos] [-b bloques] [-o archivo.wwe]
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Tamaño del programa a generar
+ */
+typedef struct {
+    int variables; /**< Variables sencillas declaradas y asignadas */
+    int listas; /**< Listas declaradas */
+    int profundidad; /**< Niveles de jeff y randy anidados en cada bloque */
+    int terminos; /**< Terminos de cada expresion */
+    int bloques; /**< Bloques anidados que se repiten */
+} Tamano;
+
+/**@cond */
+void escribirExpresion(FILE* fptr, Tamano* t, int semilla);
+void escribirBloque(FILE* fptr, Tamano* t, int bloque, int nivel);
+void sangrar(FILE* fptr, int nivel);
+/**@endcond */
+
+int main(int argc, char *argv[])
+{
+    Tamano t = {1000,10,6,8,10};
+    FILE* fptr = stdout;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if(i + 1 >= argc)
+        {
+            printf("Uso: generador [-v variables] [-l listas] [-p profundidad] [-e terminos] [-b bloques] [-o archivo.wwe]\n");
+            return 1;
+        }
+
+        char* valor = argv[++i];
+        if(!strcmp(argv[i - 1],"-v"))
+            t.variables = atoi(valor);
+        else if(!strcmp(argv[i - 1],"-l"))
+            t.listas = atoi(valor);
+        else if(!strcmp(argv[i - 1],"-p"))
+            t.profundidad = atoi(valor);
+        else if(!strcmp(argv[i - 1],"-e"))
+            t.terminos = atoi(valor);
+        else if(!strcmp(argv[i - 1],"-b"))
+            t.bloques = atoi(valor);
+        else if(!strcmp(argv[i - 1],"-o"))
+        {
+            fptr = fopen(valor,"w");
+            if(!fptr)
+            {
+                printf("No se pudo crear %s\n",valor);
+                return 1;
+            }
+        }
+        else
+        {
+            printf("Opcion desconocida: %s\n",argv[i - 1]);
+            return 1;
+        }
+    }
+
+    if(t.variables < 1)
+        t.variables = 1;
+    if(t.listas < 1)
+        t.listas = 1;
+    if(t.terminos < 1)
+        t.terminos = 1;
+
+    fprintf(fptr,"raw\n");
+
+    //Declaraciones, de 16 en 16 para que las lineas no sean enormes
+    for(int i = 0; i < t.listas; i++)
+        fprintf(fptr,"%s l%d%s",i % 16 ? "" : "    nexus",i,i % 16 == 15 || i == t.listas - 1 ? "\n" : "");
+    for(int i = 0; i < t.variables; i++)
+        fprintf(fptr,"%s v%d%s",i % 16 ? "" : "    nxt",i,i % 16 == 15 || i == t.variables - 1 ? "\n" : "");
+    for(int i = 0; i < t.profundidad; i++)
+        fprintf(fptr,"%s c%d%s",i % 16 ? "" : "    nxt",i,i % 16 == 15 || i == t.profundidad - 1 ? "\n" : "");
+    fprintf(fptr,"    nxt n\n");
+    fprintf(fptr,"    n = 4\n");
+
+    //Cada variable depende de las anteriores
+    for(int i = 0; i < t.variables; i++)
+    {
+        fprintf(fptr,"    v%d = ",i);
+        escribirExpresion(fptr,&t,i);
+        fprintf(fptr,"\n");
+    }
+
+    for(int i = 0; i < t.listas; i++)
+        for(int j = 0; j < 4; j++)
+            fprintf(fptr,"    l%d <- v%d\n",i,(i * 4 + j) % t.variables);
+
+    for(int b = 0; b < t.bloques; b++)
+        escribirBloque(fptr,&t,b,0);
+
+    fprintf(fptr,"    anunciar -> v%d <-\n",t.variables - 1);
+    fprintf(fptr,"    anunciar -> \"\\n\" <-\n");
+    fprintf(fptr,"smackdown\n");
+
+    if(fptr != stdout)
+        fclose(fptr);
+    return 0;
+}
+
+/**@cond */
+
+/*
+ * Escribe una expresion con los terminos pedidos, alternando variables, numeros y elementos de listas
+ */
+void escribirExpresion(FILE* fptr, Tamano* t, int semilla)
+{
+    static const char* operadores[] = {" + "," - "," * "," / "};
+
+    for(int k = 0; k < t->terminos; k++)
+    {
+        if(k > 0)
+            fprintf(fptr,"%s",operadores[(semilla + k) % 4]);
+
+        int cual = (semilla * 7 + k * 13) % 3;
+        if(cual == 0 && semilla > 0)
+            fprintf(fptr,"v%d",(semilla * 31 + k) % semilla);
+        else if(cual == 1 && semilla >= t->variables)
+            fprintf(fptr,"l%d[0]",(semilla + k) % t->listas);
+        else
+            fprintf(fptr,"%d",(semilla + k) % 97 + 1);
+    }
+}
+
+/*
+ * Escribe un ciclo contado en los niveles pares y un jeff con matt en los impares, hasta la profundidad pedida
+ */
+void escribirBloque(FILE* fptr, Tamano* t, int bloque, int nivel)
+{
+    int semilla = t->variables + bloque * t->profundidad + nivel;
+    int v = semilla % t->variables;
+
+    if(nivel >= t->profundidad)
+    {
+        sangrar(fptr,nivel);
+        fprintf(fptr,"v%d = ",v);
+        escribirExpresion(fptr,t,semilla);
+        fprintf(fptr,"\n");
+        sangrar(fptr,nivel);
+        fprintf(fptr,"l%d <- v%d\n",semilla % t->listas,v);
+        return;
+    }
+
+    if(nivel % 2 == 0)
+    {
+        sangrar(fptr,nivel);
+        fprintf(fptr,"c%d = 0\n",nivel);
+        sangrar(fptr,nivel);
+        fprintf(fptr,"randy c%d < n\n",nivel);
+        escribirBloque(fptr,t,bloque,nivel + 1);
+        sangrar(fptr,nivel + 1);
+        fprintf(fptr,"c%d = c%d + 1\n",nivel,nivel);
+        sangrar(fptr,nivel);
+        fprintf(fptr,"orton\n");
+    }
+    else
+    {
+        sangrar(fptr,nivel);
+        fprintf(fptr,"jeff v%d < %d\n",v,semilla % 50);
+        escribirBloque(fptr,t,bloque,nivel + 1);
+        sangrar(fptr,nivel);
+        fprintf(fptr,"matt\n");
+        sangrar(fptr,nivel + 1);
+        fprintf(fptr,"v%d = v%d - 1\n",v,v);
+        sangrar(fptr,nivel);
+        fprintf(fptr,"hardy\n");
+    }
+}
+
+/*
+ * Escribe la sangria de un nivel
+ */
+void sangrar(FILE* fptr, int nivel)
+{
+    for(int i = 0; i <= nivel; i++)
+        fprintf(fptr,"    ");
+}
+
+/**@endcond */
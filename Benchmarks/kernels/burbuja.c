@@ -0,0 +1,36 @@
+/**
+ * @file burbuja.c
+ * @brief Version en C escrita a mano de burbuja.wwe, sirve como referencia del benchmark.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main()
+{
+    float cant;
+    if(scanf("%f",&cant) != 1)
+        return 1;
+
+    long n = (long)cant;
+    float* lista = (float*)malloc((n > 0 ? n : 1) * sizeof(float));
+    for(long i = 0; i < n; i++)
+        if(scanf("%f",&lista[i]) != 1)
+            lista[i] = 0;
+
+    for(long i = 0; i < n - 1; i++)
+        for(long j = 0; j < n - i - 1; j++)
+            if(lista[j] > lista[j + 1])
+            {
+                float temp = lista[j];
+                lista[j] = lista[j + 1];
+                lista[j + 1] = temp;
+            }
+
+    if(n > 0)
+        printf("%.2f %.2f\n",lista[0],lista[n - 1]);
+    free(lista);
+    return 0;
+}
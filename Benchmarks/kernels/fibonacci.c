@@ -0,0 +1,31 @@
+/**
+ * @file fibonacci.c
+ * @brief Version en C escrita a mano de fibonacci.wwe, sirve como referencia del benchmark.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdio.h>
+
+int main()
+{
+    float number;
+    if(scanf("%f",&number) != 1)
+        return 1;
+
+    float n1 = 0, n2 = 1;
+    for(long i = 2; i < number; i++)
+    {
+        float n3 = n1 + n2;
+        n1 = n2;
+        n2 = n3;
+        if(n2 > 1000000)
+        {
+            n1 = 0;
+            n2 = 1;
+        }
+    }
+
+    printf("%.2f\n",n2);
+    return 0;
+}
@@ -0,0 +1,29 @@
+/**
+ * @file fizzbuzz.c
+ * @brief Version en C escrita a mano de fizzbuzz.wwe, sirve como referencia del benchmark.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdio.h>
+
+int main()
+{
+    float number;
+    if(scanf("%f",&number) != 1)
+        return 1;
+
+    for(long i = 1; i <= number; i++)
+    {
+        if(i % 15 == 0)
+            fputs("fizzbuzz\n",stdout);
+        else if(i % 5 == 0)
+            fputs("buzz\n",stdout);
+        else if(i % 3 == 0)
+            fputs("fizz\n",stdout);
+        else
+            printf("%.2f\n",(float)i);
+    }
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file suma.c
+ * @brief Version en C escrita a mano de suma.wwe, sirve como referencia del benchmark.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main()
+{
+    long n = 0, tam = 1024;
+    float* lista = (float*)malloc(tam * sizeof(float));
+    float num;
+    while(scanf("%f",&num) == 1)
+    {
+        if(n == tam)
+        {
+            tam *= 2;
+            lista = (float*)realloc(lista,tam * sizeof(float));
+        }
+        lista[n++] = num;
+    }
+
+    float s = 0;
+    for(long i = 0; i < n; i++)
+        s = s + lista[i];
+
+    double t = 0;
+    for(long i = 0; i < n; i++)
+        t += lista[i];
+
+    printf("%.2f %.2f\n",s,(float)t);
+    free(lista);
+    return 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file medir.c
+ * @brief Mide el tiempo y las instrucciones de un programa generado.
+ *
+ * Corre un programa con la entrada de un archivo, tira su salida y escribe los
+ * nanosegundos de reloj y las instrucciones que retiro. Las instrucciones se leen
+ * con perf_event_open; si el sistema no lo permite se escribe -1.
+ *
+ * Uso: medir entrada.txt programa
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+/**@cond */
+int abrirContador(void);
+/**@endcond */
+
+int main(int argc, char *argv[])
+{
+    if(argc < 3)
+    {
+        printf("Uso: medir entrada.txt programa\n");
+        return 1;
+    }
+
+    int entrada = open(argv[1],O_RDONLY);
+    int nulo = open("/dev/null",O_WRONLY);
+    if(entrada < 0 || nulo < 0)
+    {
+        printf("No se pudo abrir %s\n",argv[1]);
+        return 1;
+    }
+
+    //El contador se hereda al hijo y empieza a contar en el exec
+    int contador = abrirContador();
+
+    struct timespec inicio, fin;
+    clock_gettime(CLOCK_MONOTONIC,&inicio);
+
+    pid_t hijo = fork();
+    if(hijo == 0)
+    {
+        dup2(entrada,0);
+        dup2(nulo,1);
+        execv(argv[2],argv + 2);
+        _exit(127);
+    }
+
+    int estado;
+    waitpid(hijo,&estado,0);
+    clock_gettime(CLOCK_MONOTONIC,&fin);
+
+    long long instrucciones = -1;
+    uint64_t valor;
+    if(contador >= 0 && read(contador,&valor,sizeof(valor)) == sizeof(valor))
+        instrucciones = (long long)valor;
+
+    if(!WIFEXITED(estado) || WEXITSTATUS(estado) != 0)
+    {
+        printf("El programa %s termino con error\n",argv[2]);
+        return 1;
+    }
+
+    long long ns = (long long)(fin.tv_sec - inicio.tv_sec) * 1000000000LL + (fin.tv_nsec - inicio.tv_nsec);
+    printf("%lld %lld\n",ns,instrucciones);
+    return 0;
+}
+
+/**@cond */
+
+/*
+ * Abre un contador de instrucciones de usuario para los procesos hijos, -1 si no se puede
+ */
+int abrirContador(void)
+{
+    struct perf_event_attr attr;
+    memset(&attr,0,sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.enable_on_exec = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return (int)syscall(SYS_perf_event_open,&attr,0,-1,-1,0);
+}
+
+/**@endcond */
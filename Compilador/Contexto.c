@@ -0,0 +1,391 @@
+/**
+ * @file Contexto.c
+ * @brief Compilacion de un archivo .wwe de principio a fin.
+ *
+ * Corre todas las fases sobre un contexto: lexico, parser, enunciados,
+ * optimizacion, traduccion y gcc. Todo el estado vive en el contexto, asi
+ * que se puede llamar desde varios hilos con contextos distintos.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include "Contexto.h"
+#include "Rangos.h"
+#include "Paralelo.h"
+#include "Servidor.h"
+
+extern char** environ;
+
+/**
+ * @brief Inicializar contexto
+ * @ingroup funciones_contexto
+ *
+ * @param ctx Contexto a inicializar
+ * @param filename Archivo .wwe a compilar
+ * @param archivo_salida Nombre del ejecutable, se copia. NULL si no se llama a gcc
+ * @param opciones Opciones de la compilacion, se copian
+ */
+void inicializarContexto(Contexto* ctx, char* filename, char* archivo_salida, Opciones* opciones)
+{
+    memset(ctx,0,sizeof(Contexto));
+    ctx->filename = filename;
+    ctx->opciones = *opciones;
+    if(archivo_salida)
+    {
+        ctx->archivo_salida = strdup(archivo_salida);
+        snprintf(ctx->archivo_c,sizeof(ctx->archivo_c),"%s_temp.c",archivo_salida);
+    }
+    inicializarTokens(&ctx->tokens);
+    inicializarPila(&ctx->copia);
+    ctx->medicion.archivo = filename;
+}
+
+/**
+ * @brief Liberar contexto
+ * @ingroup funciones_contexto
+ *
+ * Borra los tokens, la tabla de simbolos y los enunciados del contexto.
+ *
+ * @param ctx Contexto a liberar
+ */
+void liberarContexto(Contexto* ctx)
+{
+    vaciarPilaCompleto(&ctx->copia);
+    borrarLista(&ctx->tokens);
+    if(ctx->programa)
+    {
+        eliminarPrograma(ctx->programa);
+        free(ctx->programa);
+        ctx->programa = NULL;
+    }
+    liberarConjunto(&ctx->arreglosLocales);
+    free(ctx->archivo_salida);
+    ctx->archivo_salida = NULL;
+    free(ctx->codigo);
+    ctx->codigo = NULL;
+    free(ctx->mensajes);
+    ctx->mensajes = NULL;
+    ctx->tamMensajes = 0;
+}
+
+/**
+ * @brief Error de compilacion
+ * @ingroup funciones_contexto
+ *
+ * Escribe un mensaje de error de este archivo. Lleva el nombre del archivo adelante
+ * y se escribe de una sola vez, para que con -j los errores de archivos distintos
+ * no se mezclen. Si el contexto guarda sus mensajes, como en la libreria, se agrega
+ * a los mensajes del contexto en vez de escribirse.
+ *
+ * @param ctx Contexto del archivo con el error
+ * @param formato Formato del mensaje como en printf, sin salto de linea
+ */
+void errorCompilacion(Contexto* ctx, const char* formato, ...)
+{
+    char mensaje[512];
+    va_list argumentos;
+    va_start(argumentos,formato);
+    vsnprintf(mensaje,sizeof(mensaje),formato,argumentos);
+    va_end(argumentos);
+
+    if(!ctx->guardarMensajes)
+    {
+        printf("%s: %s\n",ctx->filename,mensaje);
+        return;
+    }
+
+    size_t largo = strlen(ctx->filename) + strlen(mensaje) + 3;
+    char* mensajes = (char*)realloc(ctx->mensajes,ctx->tamMensajes + largo + 1);
+    if(!mensajes)
+        return;
+    snprintf(mensajes + ctx->tamMensajes,largo + 1,"%s: %s\n",ctx->filename,mensaje);
+    ctx->mensajes = mensajes;
+    ctx->tamMensajes += largo;
+}
+
+/**
+ * @brief Compilar
+ * @ingroup funciones_contexto
+ *
+ * Compila el archivo del contexto hasta crear el ejecutable. Con --time-report
+ * escribe el reporte del archivo en la salida de errores. Con --connect lo
+ * compila el servidor, y si no hay servidor se compila aqui.
+ *
+ * @param ctx Contexto con el archivo a compilar
+ *
+ * @return int Si se creo el ejecutable
+ */
+int compilar(Contexto* ctx)
+{
+    Medicion* medicion = &ctx->medicion;
+
+    if(ctx->opciones.servidor)
+    {
+        int remoto = compilarRemoto(ctx);
+        if(remoto >= 0)
+            return remoto;
+    }
+
+    if(!construirPrograma(ctx))
+    {
+        if(ctx->tokens.inicio && ctx->opciones.reporte)
+        {
+            flockfile(stderr);
+            imprimirMedicion(medicion,stderr,ctx->opciones.reporte == REPORTE_JSON);
+            funlockfile(stderr);
+        }
+        return 0;
+    }
+
+    iniciarFase(medicion);
+    FILE *fptr = fopen(ctx->archivo_c,"w");
+    if(fptr == NULL)
+    {
+        errorCompilacion(ctx,"No se pudo crear %s: %s",ctx->archivo_c,strerror(errno));
+        return 0;
+    }
+    traductor(ctx,fptr);
+    terminarFase(medicion,FASE_TRADUCCION);
+
+    int res = ejecutarGcc(ctx);
+
+    if(ctx->opciones.reporte)
+    {
+        flockfile(stderr);
+        imprimirMedicion(medicion,stderr,ctx->opciones.reporte == REPORTE_JSON);
+        funlockfile(stderr);
+    }
+
+    if(!res)
+        errorCompilacion(ctx,"Error al compilar");
+
+    remove(ctx->archivo_c);
+    return res;
+}
+
+/**
+ * @brief Construir programa
+ * @ingroup funciones_contexto
+ *
+ * Hace el lexico, el parser, los enunciados y el optimizador, dejando la lista
+ * de enunciados en el contexto lista para traducirse. No escribe ningun archivo.
+ * Si el contexto ya trae tokens, como en --watch, no se vuelve a hacer el lexico,
+ * y si trae los enunciados anteriores solo se crean los de las lineas que cambiaron.
+ *
+ * @param ctx Contexto con el archivo o el texto a compilar
+ *
+ * @return int Si el programa esta correcto
+ */
+int construirPrograma(Contexto* ctx)
+{
+    Medicion* medicion = &ctx->medicion;
+
+    //Con --watch los tokens ya vienen del texto anterior
+    if(!ctx->tokens.inicio)
+    {
+        iniciarFase(medicion);
+        FILE* file = abrirFuente(ctx);
+        if(file)
+        {
+            lexerAnalysis(file,&ctx->tokens);
+            fclose(file);
+        }
+        else if(!ctx->fuente)
+            errorCompilacion(ctx,"Error opening file.");
+        terminarFase(medicion,FASE_LEXICO);
+    }
+    medicion->tokens = ctx->tokens.cant;
+
+    if(ctx->tokens.inicio == NULL)
+    {
+        errorCompilacion(ctx,"El archivo esta vacio");
+        return 0;
+    }
+
+    iniciarFase(medicion);
+    int correcto = parser(ctx);
+    terminarFase(medicion,FASE_SINTACTICO);
+    medicion->simbolos = contarSimbolos(&ctx->copia);
+
+    if(!correcto)
+    {
+        errorCompilacion(ctx,"El programa no esta correcto");
+        return 0;
+    }
+
+    //printTabla(&ctx->copia);
+
+    ctx->tokens.actual = ctx->tokens.inicio;
+
+    iniciarFase(medicion);
+    if(ctx->anterior)
+    {
+        //Con --watch solo se crean los enunciados de las lineas que cambiaron, y el
+        //optimizador trabaja sobre una copia para que anterior siga sin optimizar
+        ctx->reutilizados = reconstruirEnunciados(ctx->anterior,&ctx->tokens,&ctx->edicion);
+        ctx->programa = copiarPrograma(ctx->anterior);
+    }
+    else
+    {
+        ctx->programa = (Programa*)calloc(1,sizeof(Programa));
+        crearEnunciados(ctx->programa,&ctx->tokens);
+    }
+    terminarFase(medicion,FASE_ENUNCIADOS);
+
+    iniciarFase(medicion);
+    optimizarPrograma(ctx->programa,&ctx->opciones);
+    if(ctx->opciones.checked)
+        analizarRangos(ctx->programa);
+    analizarVectores(ctx->programa,ctx->opciones.checked);
+    if(ctx->opciones.paralelo)
+        analizarParalelos(ctx->programa,ctx->opciones.checked);
+    terminarFase(medicion,FASE_OPTIMIZACION);
+    medicion->enunciados = contarEnunciados(ctx->programa);
+    //imprimirPrograma(ctx->programa);
+
+    return 1;
+}
+
+/**
+ * @brief Abrir fuente
+ * @ingroup funciones_contexto
+ *
+ * Abre el programa para leerlo, desde memoria si el contexto tiene el texto
+ * o desde el archivo si no.
+ *
+ * @param ctx Contexto de la compilacion
+ *
+ * @return FILE* Archivo abierto para leer, NULL si no se pudo abrir o el texto esta vacio
+ */
+FILE* abrirFuente(Contexto* ctx)
+{
+    if(!ctx->fuente)
+        return fopen(ctx->filename,"r");
+
+    if(ctx->tamFuente == 0)
+        return NULL;
+    return fmemopen((void*)ctx->fuente,ctx->tamFuente,"r");
+}
+
+/**
+ * @brief Leer archivo
+ * @ingroup funciones_contexto
+ *
+ * @param filename Archivo a leer
+ * @param tam Donde se guarda el tamaño del texto
+ *
+ * @return char* Texto completo del archivo terminado en '\0', NULL si no se pudo leer
+ */
+char* leerArchivo(const char* filename, size_t* tam)
+{
+    FILE* file = fopen(filename,"rb");
+    if(!file)
+        return NULL;
+
+    fseek(file,0,SEEK_END);
+    long largo = ftell(file);
+    rewind(file);
+    char* texto = largo >= 0 ? (char*)malloc(largo + 1) : NULL;
+    if(texto)
+    {
+        *tam = fread(texto,1,largo,file);
+        texto[*tam] = '\0';
+    }
+    fclose(file);
+    return texto;
+}
+
+/**
+ * @brief Ejecutar gcc
+ * @ingroup funciones_contexto
+ *
+ * Compila el archivo .c del contexto con gcc y lo liga con Listas.c, o con
+ * Listas.o si ya se compilo para todo el lote.
+ *
+ * @param ctx Contexto con el archivo .c ya escrito
+ *
+ * @return int Si gcc termino sin errores
+ */
+int ejecutarGcc(Contexto* ctx)
+{
+    char* argumentos[16];
+    int n = banderasGcc(&ctx->opciones,argumentos);
+    if(ctx->opciones.paralelo)
+        argumentos[n++] = "-fopenmp";
+    argumentos[n++] = ctx->archivo_c;
+    argumentos[n++] = ctx->listas ? (char*)ctx->listas : "Listas.c";
+    argumentos[n++] = "-o";
+    argumentos[n++] = ctx->archivo_salida;
+    argumentos[n] = NULL;
+
+    struct rusage uso;
+    iniciarFase(&ctx->medicion);
+    int res = ejecutar(argumentos,&uso);
+    terminarFaseExterna(&ctx->medicion,FASE_GCC,res >= 0 ? &uso : NULL);
+
+    return res == 0;
+}
+
+/**
+ * @brief Banderas de gcc
+ * @ingroup funciones_contexto
+ *
+ * Escribe el comando gcc con la optimizacion, la depuracion y el tipo de numero
+ * elegidos, que son iguales para el programa y para Listas.c.
+ *
+ * @param opciones Opciones de la compilacion
+ * @param argumentos Arreglo donde se escriben, con espacio para los demas argumentos
+ *
+ * @return int Cantidad de argumentos escritos
+ */
+int banderasGcc(Opciones* opciones, char** argumentos)
+{
+    int n = 0;
+    argumentos[n++] = "gcc";
+    argumentos[n++] = "-O3";
+    //Listas.h esta en la carpeta actual aunque el .c quede en la carpeta de la salida
+    argumentos[n++] = "-I.";
+    if(opciones->depuracion)
+        argumentos[n++] = "-g";
+    if(opciones->numero == NUM_DOUBLE)
+        argumentos[n++] = "-DWWE_DOUBLE";
+    else if(opciones->numero == NUM_INT64)
+        argumentos[n++] = "-DWWE_INT64";
+    return n;
+}
+
+/**
+ * @brief Ejecutar
+ * @ingroup funciones_contexto
+ *
+ * Crea un proceso con el comando y espera a que termine. Solo espera a ese
+ * proceso, asi varios hilos pueden tener su propio gcc corriendo.
+ *
+ * @param argumentos Comando y sus argumentos, terminados en NULL
+ * @param uso Donde se guardan la CPU y la memoria del proceso
+ *
+ * @return int Codigo de salida del proceso, -1 si no se pudo crear
+ */
+int ejecutar(char** argumentos, struct rusage* uso)
+{
+    pid_t pid;
+    int estado;
+
+    if(posix_spawnp(&pid,argumentos[0],NULL,NULL,argumentos,environ) != 0)
+    {
+        printf("No se pudo ejecutar %s\n",argumentos[0]);
+        return -1;
+    }
+
+    while(wait4(pid,&estado,0,uso) < 0)
+        if(errno != EINTR)
+            return -1;
+
+    return WIFEXITED(estado) ? WEXITSTATUS(estado) : 1;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file Contexto.h
+ * @brief Estado de una compilacion.
+ *
+ * Este archivo contiene la estructura con todo lo que usa la compilacion
+ * de un archivo .wwe: los tokens, la tabla de simbolos, los enunciados,
+ * el estado del traductor, las opciones y la medicion de tiempos. Como no
+ * hay variables globales, varios archivos se pueden compilar al mismo tiempo
+ * en hilos distintos con -j, o desde otro programa con la libreria wwec.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+#include <stdio.h>
+#include <setjmp.h>
+#include <sys/resource.h>
+#include "SymbolTable.h"
+#include "Enunciados.h"
+#include "Optimizador.h"
+#include "Medicion.h"
+#include "Opciones.h"
+
+/**
+ * @brief Estado de la compilacion de un archivo
+ */
+struct Contexto {
+    char* filename; /**< Archivo .wwe a compilar, o solo su nombre si se compila desde memoria */
+    const char* fuente; /**< Texto del programa si se compila desde memoria, NULL para leer filename */
+    size_t tamFuente; /**< Tamaño de fuente */
+    Opciones opciones; /**< Opciones de esta compilacion */
+    char* archivo_salida; /**< Ejecutable que se crea, NULL si no se llama a gcc */
+    char archivo_c[256]; /**< Archivo .c temporal */
+    char* codigo; /**< Codigo C escrito en memoria, NULL si no se ha pedido */
+    size_t tamCodigo; /**< Tamaño de codigo sin el terminador */
+    const char* listas; /**< Listas.o ya compilado para ligar, NULL para compilar Listas.c */
+    Tokens tokens; /**< Lista de tokens del archivo */
+    Pila copia; /**< Copia de la tabla de simbolos con todos sus scopes */
+    int declaracion; /**< 1 si el parser esta en una declaracion de variables, 2 si es de listas, 0 si no */
+    jmp_buf error; /**< Punto del parser al que regresa term ante un error */
+    int lineaError; /**< Linea del error del parser, 0 si no hubo */
+    int columnaError; /**< Columna del error del parser */
+    int guardarMensajes; /**< 1 si los mensajes de error se guardan en mensajes en vez de escribirse, como en la libreria */
+    char* mensajes; /**< Mensajes de error guardados, uno por linea, NULL si no hay */
+    size_t tamMensajes; /**< Tamaño de mensajes sin el terminador */
+    Programa* programa; /**< Lista de enunciados del archivo */
+    Programa* anterior; /**< Enunciados sin optimizar de la compilacion anterior con --watch, NULL si no hay */
+    Edicion edicion; /**< Lineas que cambiaron desde la compilacion anterior, solo si hay anterior */
+    int reutilizados; /**< Enunciados de anterior que no se volvieron a crear */
+    Conjunto arreglosLocales; /**< Listas cuyo arreglo y tamaño ya estan copiados a variables locales del ciclo que se escribe */
+    int perfilApagado; /**< Ciclos paralelos que contienen lo que se escribe, adentro no se ponen marcas del perfil */
+    Medicion medicion; /**< Tiempos de cada fase para --time-report */
+};
+
+/**
+ * @defgroup funciones_contexto Funciones de la compilacion de un archivo
+ * @{
+ */
+void inicializarContexto(Contexto* ctx, char* filename, char* archivo_salida, Opciones* opciones);
+void liberarContexto(Contexto* ctx);
+void errorCompilacion(Contexto* ctx, const char* formato, ...);
+int compilar(Contexto* ctx);
+int construirPrograma(Contexto* ctx);
+FILE* abrirFuente(Contexto* ctx);
+char* leerArchivo(const char* filename, size_t* tam);
+int ejecutarGcc(Contexto* ctx);
+int ejecutar(char** argumentos, struct rusage* uso);
+int banderasGcc(Opciones* opciones, char** argumentos);
+void traductor(Contexto* ctx, FILE *fptr);
+/** @} */
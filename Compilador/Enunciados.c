@@ -31,6 +31,141 @@ void crearEnunciados(Programa* programa, Tokens* tokens)
     while(esEnunciado(programa,tokens));
 }
 
+/**
+ * @brief Reconstruye los enunciados despues de un cambio.
+ * @ingroup funciones_enunciados
+ *
+ * Usa los enunciados del texto anterior y solo vuelve a crear los enunciados de
+ * afuera que tocan las lineas que cambiaron, con todo su bloque de jeff o randy.
+ * Cada enunciado abarca desde su linea hasta antes de la del siguiente. Los de
+ * antes del cambio se quedan igual y a los de despues solo se les cambia la linea.
+ * Si el cambio toca la linea de raw o los enunciados nuevos no terminan donde
+ * empiezan los de despues, se crean todos otra vez.
+ *
+ * @param programa Enunciados sin optimizar del texto anterior, quedan los del texto nuevo.
+ * @param tokens Lista de todos los tokens del texto nuevo, ya revisada por el parser.
+ * @param edicion Lineas que cambiaron entre los dos textos.
+ *
+ * @return int Cantidad de enunciados que se reutilizaron.
+ */
+
+int reconstruirEnunciados(Programa* programa, Tokens* tokens, Edicion* edicion)
+{
+    int linea = edicion->linea;
+    int finAnterior = edicion->linea + edicion->anteriores;
+    int desplazamiento = edicion->nuevas - edicion->anteriores;
+
+    Enunciado *antes = NULL, *primero = programa->lista_enunciados;
+    while(primero && primero->siguiente && primero->siguiente->linea <= linea)
+    {
+        antes = primero;
+        primero = primero->siguiente;
+    }
+    if(primero == NULL || primero->linea > linea)
+        return rehacerEnunciados(programa,tokens);
+
+    Enunciado *despues = primero;
+    while(despues && despues->linea < finAnterior)
+        despues = despues->siguiente;
+
+    //El primer enunciado a crear empieza una linea
+    Nodo *inicio = tokens->inicio;
+    int i = 0;
+    while(i < tokens->cant && inicio->token->linea < primero->linea)
+    {
+        inicio = inicio->next;
+        i++;
+    }
+    if(i == 0 || i == tokens->cant || strcmp(inicio->prev->token->tipoToken,"FIN-LINEA"))
+        return rehacerEnunciados(programa,tokens);
+
+    Nodo *frontera = NULL;
+    if(despues)
+    {
+        frontera = inicio;
+        while(i < tokens->cant && frontera->token->linea < despues->linea + desplazamiento)
+        {
+            frontera = frontera->next;
+            i++;
+        }
+        if(i == tokens->cant)
+            return rehacerEnunciados(programa,tokens);
+    }
+
+    Programa nuevos = {0};
+    tokens->actual = inicio;
+    while(tokens->actual != frontera && esEnunciado(&nuevos,tokens));
+    if(tokens->actual != frontera)
+    {
+        eliminarPrograma(&nuevos);
+        return rehacerEnunciados(programa,tokens);
+    }
+
+    //Se borran los enunciados que cambiaron y se ponen los nuevos en su lugar
+    if(primero != despues)
+    {
+        Programa viejos = {0};
+        viejos.lista_enunciados = primero;
+        Enunciado *ultimo = primero;
+        while(ultimo->siguiente != despues)
+            ultimo = ultimo->siguiente;
+        ultimo->siguiente = NULL;
+        eliminarPrograma(&viejos);
+    }
+
+    int creados = 0;
+    for(Enunciado *e = nuevos.lista_enunciados; e != NULL; e = e->siguiente)
+        creados++;
+
+    Enunciado *siguiente = nuevos.lista_enunciados ? nuevos.lista_enunciados : despues;
+    if(antes)
+        antes->siguiente = siguiente;
+    else
+        programa->lista_enunciados = siguiente;
+    if(nuevos.ultimo_enunciado)
+        nuevos.ultimo_enunciado->siguiente = despues;
+    if(despues == NULL)
+        programa->ultimo_enunciado = nuevos.ultimo_enunciado ? nuevos.ultimo_enunciado : antes;
+    moverLineas(despues,desplazamiento);
+
+    //La declaracion de listas pudo cambiar
+    int total = 0;
+    programa->listas = 0;
+    programa->variables = NULL;
+    programa->cantidad = 0;
+    for(Enunciado *e = programa->lista_enunciados; e != NULL; e = e->siguiente, total++)
+        if(e->tipo == ENUNC_DECLARACION_LISTA)
+        {
+            programa->listas = 1;
+            programa->variables = e->declaracion.variables;
+            programa->cantidad = e->declaracion.cantidad;
+        }
+
+    return total - creados;
+}
+
+/**
+ * @brief Vuelve a crear todos los enunciados.
+ * @ingroup funciones_enunciados
+ *
+ * @param programa Enunciados a reemplazar.
+ * @param tokens Lista de todos los tokens almacenado.
+ *
+ * @return int Siempre 0, ningun enunciado se reutilizo.
+ */
+
+int rehacerEnunciados(Programa* programa, Tokens* tokens)
+{
+    eliminarPrograma(programa);
+    programa->listas = 0;
+    programa->variables = NULL;
+    programa->cantidad = 0;
+
+    tokens->actual = tokens->inicio;
+    crearEnunciados(programa,tokens);
+    return 0;
+}
+
 /**
  * @brief Revisa cada enunciado.
  * @ingroup funciones_enunciados
@@ -55,57 +190,79 @@ int esEnunciado(Programa* programa, Tokens* tokens)
     
     //printf("Token: %s\n",tokens->actual->token->cadena);
     Nodo *prev = tokens->actual;
+    Enunciado *anterior = programa->ultimo_enunciado;
 
     if(inicializar(programa,tokens))
     {
-        return 1;
+        return marcarLinea(programa,anterior,prev->token);
     }
 
     tokens->actual = prev;
 
     if(inicializarLista(programa,tokens))
     {
-        return 1;
+        return marcarLinea(programa,anterior,prev->token);
     }
     tokens->actual = prev;
 
     if(leer(programa,tokens))
     {
-        return 1;
+        return marcarLinea(programa,anterior,prev->token);
     }
     tokens->actual = prev;
 
     if(asignacion_trad(programa,tokens))
     {
-        return 1;
+        return marcarLinea(programa,anterior,prev->token);
     }
 
     tokens->actual = prev;
 
     if(asignacion_lista(programa,tokens))
     {
-        return 1;
+        return marcarLinea(programa,anterior,prev->token);
+    }
+
+    tokens->actual = prev;
+
+    if(operar_trad(programa,tokens))
+    {
+        return marcarLinea(programa,anterior,prev->token);
     }
 
     tokens->actual = prev;
 
     if(si_trad(programa,tokens))
     {
-        return 1;
+        return marcarLinea(programa,anterior,prev->token);
     }
 
     tokens->actual = prev;
 
     if(mientras_trad(programa,tokens))
     {
-        return 1;
+        return marcarLinea(programa,anterior,prev->token);
     }
 
     tokens->actual = prev;
 
     if(anunciar_trad(programa,tokens))
     {
-        return 1;
+        return marcarLinea(programa,anterior,prev->token);
+    }
+
+    tokens->actual = prev;
+
+    if(ordenar_trad(programa,tokens))
+    {
+        return marcarLinea(programa,anterior,prev->token);
+    }
+
+    tokens->actual = prev;
+
+    if(archivo_trad(programa,tokens))
+    {
+        return marcarLinea(programa,anterior,prev->token);
     }
 
     tokens->actual = prev;
@@ -116,6 +273,7 @@ int esEnunciado(Programa* programa, Tokens* tokens)
     }
 
     tokens->actual = tokens->actual->next;
+    return 1;
 }
 
 /**
@@ -248,6 +406,16 @@ int leer(Programa* programa, Tokens *tokens)
                 pushEnunciado(programa,nuevo);
                 return 1;
             }
+            else if(!strcmp(tokens->actual->token->tipoToken,"PROMOS"))
+            {
+                Enunciado* nuevo = (Enunciado*)calloc(1,sizeof(Enunciado));
+                nuevo->tipo = ENUNC_LEER_TODO;
+
+                nuevo->leer.variable = strdup(var->token->cadena);
+                tokens->actual = tokens->actual->next;
+                pushEnunciado(programa,nuevo);
+                return 1;
+            }
             return 0;
         }
     }
@@ -271,7 +439,7 @@ int asignacion_trad(Programa* programa, Tokens* tokens)
     {
         int esLista = 0;
         Nodo *var = tokens->actual;
-        Valor valor;
+        Valor valor = {0};
 
         tokens->actual = tokens->actual->next;
         if(!strcmp(tokens->actual->token->tipoToken,"LBRACKET"))
@@ -409,6 +577,38 @@ int asignacion_lista(Programa* programa, Tokens *tokens)
     }
     return 0;
 }
+/**
+ * @brief Token Operar
+ * @ingroup funciones_enunciados
+ *
+ * Crea un enunciado del tipo operar lista para +=, -=, *= y /= sobre una lista.
+ *
+ * @param programa Lista de todos los enunciados actuales.
+ * @param tokens Lista de todos los tokens almacenado.
+ *
+ */
+int operar_trad(Programa* programa, Tokens *tokens)
+{
+    if(!strcmp(tokens->actual->token->tipoToken,"VARIABLE") && !strcmp(tokens->actual->next->token->tipoToken,"OPASIGNACION"))
+    {
+        Enunciado* nuevo = (Enunciado*)calloc(1,sizeof(Enunciado));
+        nuevo->tipo = ENUNC_OPERAR_LISTA;
+        nuevo->operar.lista = strdup(tokens->actual->token->cadena);
+
+        tokens->actual = tokens->actual->next;
+        nuevo->operar.operador = strndup(tokens->actual->token->cadena,1);
+        tokens->actual = tokens->actual->next;
+
+        nuevo->operar.expresion = (Expresion*)calloc(1,sizeof(Expresion));
+        expDerecha(programa,tokens,nuevo->operar.expresion);
+
+        tokens->actual = tokens->actual->next;
+
+        pushEnunciado(programa,nuevo);
+        return 1;
+    }
+    return 0;
+}
 /**
  * @brief Token Si
  * @ingroup funciones_enunciados
@@ -518,7 +718,20 @@ int anunciar_trad(Programa *programa,Tokens *tokens)
         tokens->actual = tokens->actual->next;
         tokens->actual = tokens->actual->next;
 
-        if(!strcmp(tokens->actual->token->tipoToken,"STRING"))
+        //Una lista seguida del separador se imprime completa
+        if(!strcmp(tokens->actual->token->tipoToken,"VARIABLE") && !strcmp(tokens->actual->next->token->tipoToken,"STRING"))
+        {
+            nuevo->tipo = ENUNC_ANUNCIAR_LISTA;
+            nuevo->anunciarLista.lista = strdup(tokens->actual->token->cadena);
+            tokens->actual = tokens->actual->next;
+            nuevo->anunciarLista.separador = strdup(tokens->actual->token->cadena);
+            tokens->actual = tokens->actual->next;
+            tokens->actual = tokens->actual->next;
+
+            pushEnunciado(programa,nuevo);
+            return 1;
+        }
+        else if(!strcmp(tokens->actual->token->tipoToken,"STRING"))
         {
             nuevo->anunciar.esCadena = 1;
             nuevo->anunciar.cadena = strdup(tokens->actual->token->cadena);
@@ -564,6 +777,64 @@ int anunciar_trad(Programa *programa,Tokens *tokens)
 
     return 0;
 }
+/**
+ * @brief Token Ordenar
+ * @ingroup funciones_enunciados
+ *
+ * Crea un enunciado del tipo ordenar para toda la lista.
+ *
+ * @param programa Lista de todos los enunciados actuales.
+ * @param tokens Lista de todos los tokens almacenado.
+ *
+ */
+int ordenar_trad(Programa *programa,Tokens *tokens)
+{
+    if(!strcmp(tokens->actual->token->tipoToken,"ORDENAR"))
+    {
+        tokens->actual = tokens->actual->next;
+
+        Enunciado* nuevo = (Enunciado*)calloc(1,sizeof(Enunciado));
+        nuevo->tipo = ENUNC_ORDENAR;
+        nuevo->ordenar.lista = strdup(tokens->actual->token->cadena);
+        nuevo->ordenar.parcial = 0;
+        tokens->actual = tokens->actual->next;
+
+        pushEnunciado(programa,nuevo);
+        return 1;
+    }
+
+    return 0;
+}
+/**
+ * @brief Token Guardar o Cargar
+ * @ingroup funciones_enunciados
+ *
+ * Crea un enunciado del tipo guardar lista o cargar lista con el archivo binario.
+ *
+ * @param programa Lista de todos los enunciados actuales.
+ * @param tokens Lista de todos los tokens almacenado.
+ *
+ */
+int archivo_trad(Programa *programa,Tokens *tokens)
+{
+    int guardar = !strcmp(tokens->actual->token->tipoToken,"GUARDAR");
+    if(guardar || !strcmp(tokens->actual->token->tipoToken,"CARGAR"))
+    {
+        tokens->actual = tokens->actual->next;
+
+        Enunciado* nuevo = (Enunciado*)calloc(1,sizeof(Enunciado));
+        nuevo->tipo = guardar ? ENUNC_GUARDAR_LISTA : ENUNC_CARGAR_LISTA;
+        nuevo->archivo.lista = strdup(tokens->actual->token->cadena);
+        tokens->actual = tokens->actual->next;
+        nuevo->archivo.archivo = strdup(tokens->actual->token->cadena);
+        tokens->actual = tokens->actual->next;
+
+        pushEnunciado(programa,nuevo);
+        return 1;
+    }
+
+    return 0;
+}
 /**
  * @brief Expresion Derecha
  * @ingroup funciones_tipo
@@ -609,7 +880,7 @@ void expDerecha(Programa* programa, Tokens* tokens, Expresion *derecha)
  */
 Valor esValor(Programa* programa, Tokens* tokens)
 {
-    Valor valor;
+    Valor valor = {0};
     if (!strcmp(tokens->actual->token->tipoToken, "VARIABLE")) {
         valor.tipo = VAL_VARIABLE;
         valor.nombre = strdup(tokens->actual->token->cadena);  // Variable
@@ -641,6 +912,25 @@ Valor esValor(Programa* programa, Tokens* tokens)
             valor.tipo = VAL_LISTA_S;
             tokens->actual = tokens->actual->next;
         }
+        else if(!strcmp(tokens->actual->token->tipoToken,"SUM")){
+            valor.tipo = VAL_LISTA_T;
+            tokens->actual = tokens->actual->next;
+        }
+        else if(!strcmp(tokens->actual->token->tipoToken,"MIN")){
+            valor.tipo = VAL_LISTA_N;
+            tokens->actual = tokens->actual->next;
+        }
+        else if(!strcmp(tokens->actual->token->tipoToken,"MAX")){
+            valor.tipo = VAL_LISTA_X;
+            tokens->actual = tokens->actual->next;
+        }
+        else if(!strcmp(tokens->actual->token->tipoToken,"DOT")){
+            //.p [ lista ]
+            valor.tipo = VAL_LISTA_P;
+            tokens->actual = tokens->actual->next->next;
+            valor.var = strdup(tokens->actual->token->cadena);
+            tokens->actual = tokens->actual->next->next;
+        }
         else {
             valor.tipo = VAL_VARIABLE;
         }
@@ -696,6 +986,66 @@ void pushEnunciado(Programa* programa, Enunciado* enunciado)
     programa->ultimo_enunciado = enunciado;
 }
 
+/**
+ * @brief Marcar linea
+ * @ingroup funciones_lista
+ *
+ * Guarda la linea y la columna del archivo en los enunciados que se agregaron despues de
+ * anterior, un solo enunciado del archivo puede crear varios, como anunciar con varias partes.
+ *
+ * @param programa Lista de enunciados donde se agregaron
+ * @param anterior Ultimo enunciado antes de revisar la linea, NULL si la lista estaba vacia
+ * @param inicio Primer token del enunciado
+ *
+ * @return int Siempre 1, para regresarlo desde esEnunciado
+ */
+int marcarLinea(Programa* programa, Enunciado* anterior, Token* inicio)
+{
+    Enunciado *e = anterior ? anterior->siguiente : programa->lista_enunciados;
+    for(; e != NULL; e = e->siguiente)
+        if(!e->linea) {
+            e->linea = inicio->linea;
+            e->columna = inicio->columna;
+        }
+
+    return 1;
+}
+
+/**
+ * @brief Mover lineas
+ * @ingroup funciones_lista
+ *
+ * Le suma un desplazamiento a la linea de cada enunciado desde el indicado,
+ * con los de sus bloques, cuando cambia la cantidad de lineas antes de ellos.
+ *
+ * @param enunciado Primer enunciado a mover, se siguen los siguientes.
+ * @param desplazamiento Lineas que se suman, pueden ser negativas.
+ */
+void moverLineas(Enunciado* enunciado, int desplazamiento)
+{
+    if(desplazamiento == 0)
+        return;
+
+    for(Enunciado *e = enunciado; e != NULL; e = e->siguiente)
+    {
+        if(e->linea)
+            e->linea += desplazamiento;
+
+        if(e->tipo == ENUNC_SI)
+        {
+            moverLineas(e->si.entonces->lista_enunciados,desplazamiento);
+            if(e->si.si_no)
+                moverLineas(e->si.si_no->lista_enunciados,desplazamiento);
+        }
+        else if(e->tipo == ENUNC_MIENTRAS)
+        {
+            moverLineas(e->mientras.cuerpo->lista_enunciados,desplazamiento);
+            if(e->mientras.previo)
+                moverLineas(e->mientras.previo->lista_enunciados,desplazamiento);
+        }
+    }
+}
+
 /**
  * @brief Imprimir Enunciado
  * @brief funciones_imprimir
@@ -729,6 +1079,10 @@ void imprimirEnunciado(Enunciado* e) {
                 printf("Leer variable: %s\n", e->leer.variable);
                 break;
 
+            case ENUNC_LEER_TODO:
+                printf("Leer toda la entrada en: %s\n", e->leer.variable);
+                break;
+
             case ENUNC_ANUNCIAR:
                 if (e->anunciar.esCadena) {
                     printf("Anunciar cadena: \"%s\"\n", e->anunciar.cadena);
@@ -752,6 +1106,28 @@ void imprimirEnunciado(Enunciado* e) {
                 }
                 break;
 
+            case ENUNC_ORDENAR:
+                printf("Ordenar lista: %s\n", e->ordenar.lista);
+                break;
+
+            case ENUNC_ANUNCIAR_LISTA:
+                printf("Anunciar lista %s separada por %s\n", e->anunciarLista.lista, e->anunciarLista.separador);
+                break;
+
+            case ENUNC_GUARDAR_LISTA:
+                printf("Guardar lista %s en %s\n", e->archivo.lista, e->archivo.archivo);
+                break;
+
+            case ENUNC_CARGAR_LISTA:
+                printf("Cargar lista %s de %s\n", e->archivo.lista, e->archivo.archivo);
+                break;
+
+            case ENUNC_OPERAR_LISTA:
+                printf("Operar lista %s con %s: ", e->operar.lista, e->operar.operador);
+                imprimirExpresion(e->operar.expresion);
+                printf("\n");
+                break;
+
             case ENUNC_MIENTRAS:
                 printf("Mientras:\n  Condición:\n    ");
                 imprimirValor(e->mientras.comp.izquierda);
@@ -820,6 +1196,18 @@ void imprimirValor(Valor val) {
             case VAL_LISTA_S:
                 printf("%s.s",val.nombre);
                 break;
+            case VAL_LISTA_T:
+                printf("%s.t",val.nombre);
+                break;
+            case VAL_LISTA_N:
+                printf("%s.n",val.nombre);
+                break;
+            case VAL_LISTA_X:
+                printf("%s.x",val.nombre);
+                break;
+            case VAL_LISTA_P:
+                printf("%s.p[%s]",val.nombre,val.var);
+                break;
             default:
                 printf("Valor desconocido");
         }
@@ -900,13 +1288,194 @@ void liberarExpresion(Expresion* expr) {
  */
 void liberarValor(Valor *valor)
 {
-    if(valor->tipo == VAL_VARIABLE || valor->tipo == VAL_LISTA_F || valor->tipo == VAL_LISTA_L || valor->tipo == VAL_LISTA_S || valor->tipo == VAL_LISTA_INDEX)
+    if(valor->tipo == VAL_VARIABLE || valor->tipo == VAL_LISTA_F || valor->tipo == VAL_LISTA_L || valor->tipo == VAL_LISTA_S || valor->tipo == VAL_LISTA_INDEX
+        || valor->tipo == VAL_LISTA_T || valor->tipo == VAL_LISTA_N || valor->tipo == VAL_LISTA_X)
         free(valor->nombre);
-    else if(valor->tipo == VAL_LISTA_INDEX_VAR){
+    else if(valor->tipo == VAL_LISTA_INDEX_VAR || valor->tipo == VAL_LISTA_P){
         free(valor->var);
         free(valor->nombre);
     }
 }
+/**
+ * @brief Copiar Valor
+ *
+ * Copia un valor con sus propias cadenas para que se pueda liberar por separado.
+ *
+ * @param valor Valor a copiar.
+ *
+ * @return Valor Copia del valor.
+ */
+Valor copiarValor(Valor valor)
+{
+    Valor copia = valor;
+    if(valor.nombre)
+        copia.nombre = strdup(valor.nombre);
+    if((valor.tipo == VAL_LISTA_INDEX_VAR || valor.tipo == VAL_LISTA_P) && valor.var)
+        copia.var = strdup(valor.var);
+    return copia;
+}
+/**
+ * @brief Copiar Expresion
+ *
+ * Copia una expresion completa con sus propias cadenas.
+ *
+ * @param expr Expresion a copiar, puede ser NULL.
+ *
+ * @return Expresion* Copia de la expresion.
+ */
+Expresion* copiarExpresion(Expresion* expr)
+{
+    if(!expr)
+        return NULL;
+
+    Expresion* copia = (Expresion*)malloc(sizeof(Expresion));
+    *copia = *expr;
+    if(expr->tipo == EXPR_BINARIA)
+    {
+        copia->binaria.izquierda = copiarExpresion(expr->binaria.izquierda);
+        copia->binaria.derecha = copiarExpresion(expr->binaria.derecha);
+        copia->binaria.oparitmetico = expr->binaria.oparitmetico ? strdup(expr->binaria.oparitmetico) : NULL;
+    }
+    else
+        copia->valor = copiarValor(expr->valor);
+
+    return copia;
+}
+/**
+ * @brief Copiar Enunciado
+ *
+ * Copia un enunciado con sus bloques, sin el enunciado siguiente.
+ *
+ * @param enunciado Enunciado a copiar.
+ *
+ * @return Enunciado* Copia del enunciado.
+ */
+Enunciado* copiarEnunciado(Enunciado* enunciado)
+{
+    Enunciado* copia = (Enunciado*)malloc(sizeof(Enunciado));
+    *copia = *enunciado;
+    copia->siguiente = NULL;
+
+    switch (enunciado->tipo) {
+        case ENUNC_DECLARACION:
+        case ENUNC_DECLARACION_LISTA:
+            copia->declaracion.variables = NULL;
+            if (enunciado->declaracion.cantidad)
+                copia->declaracion.variables = (char**)malloc(enunciado->declaracion.cantidad * sizeof(char*));
+            for (int i = 0; i < enunciado->declaracion.cantidad; i++)
+                copia->declaracion.variables[i] = strdup(enunciado->declaracion.variables[i]);
+            if (enunciado->declaracion.enteros) {
+                copia->declaracion.enteros = (int*)malloc(enunciado->declaracion.cantidad * sizeof(int));
+                memcpy(copia->declaracion.enteros,enunciado->declaracion.enteros,enunciado->declaracion.cantidad * sizeof(int));
+            }
+            break;
+
+        case ENUNC_ASIGNACION:
+        case ENUNC_ASIGNACION_LISTA:
+            copia->asignacion.variable = copiarValor(enunciado->asignacion.variable);
+            copia->asignacion.expresion = copiarExpresion(enunciado->asignacion.expresion);
+            break;
+
+        case ENUNC_LEER:
+        case ENUNC_LEER_LISTA:
+        case ENUNC_LEER_TODO:
+            copia->leer.variable = strdup(enunciado->leer.variable);
+            break;
+
+        case ENUNC_ANUNCIAR:
+            if (enunciado->anunciar.esCadena)
+                copia->anunciar.cadena = strdup(enunciado->anunciar.cadena);
+            else
+                copia->anunciar.expresion = copiarExpresion(enunciado->anunciar.expresion);
+            break;
+
+        case ENUNC_SI:
+            copia->si.comp.izquierda = copiarValor(enunciado->si.comp.izquierda);
+            copia->si.comp.derecha = copiarValor(enunciado->si.comp.derecha);
+            copia->si.entonces = copiarPrograma(enunciado->si.entonces);
+            if (enunciado->si.si_no)
+                copia->si.si_no = copiarPrograma(enunciado->si.si_no);
+            break;
+
+        case ENUNC_MIENTRAS:
+            copia->mientras.comp.izquierda = copiarValor(enunciado->mientras.comp.izquierda);
+            copia->mientras.comp.derecha = copiarValor(enunciado->mientras.comp.derecha);
+            copia->mientras.cuerpo = copiarPrograma(enunciado->mientras.cuerpo);
+            if (enunciado->mientras.previo)
+                copia->mientras.previo = copiarPrograma(enunciado->mientras.previo);
+            copia->mientras.contador = enunciado->mientras.contador ? strdup(enunciado->mientras.contador) : NULL;
+            copia->mientras.inductor = enunciado->mientras.inductor ? strdup(enunciado->mientras.inductor) : NULL;
+            copia->mientras.paralelo = enunciado->mientras.paralelo ? strdup(enunciado->mientras.paralelo) : NULL;
+            if (enunciado->mientras.cantidadArreglos) {
+                copia->mientras.arreglos = (char**)malloc(enunciado->mientras.cantidadArreglos * sizeof(char*));
+                for (int i = 0; i < enunciado->mientras.cantidadArreglos; i++)
+                    copia->mientras.arreglos[i] = strdup(enunciado->mientras.arreglos[i]);
+            }
+            break;
+
+        case ENUNC_ANUNCIAR_LISTA:
+            copia->anunciarLista.lista = strdup(enunciado->anunciarLista.lista);
+            copia->anunciarLista.separador = strdup(enunciado->anunciarLista.separador);
+            break;
+
+        case ENUNC_GUARDAR_LISTA:
+        case ENUNC_CARGAR_LISTA:
+            copia->archivo.lista = strdup(enunciado->archivo.lista);
+            copia->archivo.archivo = strdup(enunciado->archivo.archivo);
+            break;
+
+        case ENUNC_OPERAR_LISTA:
+            copia->operar.lista = strdup(enunciado->operar.lista);
+            copia->operar.operador = strdup(enunciado->operar.operador);
+            copia->operar.expresion = copiarExpresion(enunciado->operar.expresion);
+            break;
+
+        case ENUNC_ORDENAR:
+            copia->ordenar.lista = strdup(enunciado->ordenar.lista);
+            if (enunciado->ordenar.parcial)
+                copia->ordenar.hasta = copiarValor(enunciado->ordenar.hasta);
+            break;
+
+        case ENUNC_RESERVAR_LISTA:
+            copia->reservar.lista = strdup(enunciado->reservar.lista);
+            copia->reservar.desde = copiarValor(enunciado->reservar.desde);
+            copia->reservar.hasta = copiarValor(enunciado->reservar.hasta);
+            break;
+
+        default:
+            break;
+    }
+
+    return copia;
+}
+/**
+ * @brief Copiar Programa
+ *
+ * Copia todos los enunciados de un programa, para optimizar la copia sin
+ * cambiar el original.
+ *
+ * @param programa Programa a copiar.
+ *
+ * @return Programa* Copia del programa.
+ */
+Programa* copiarPrograma(Programa* programa)
+{
+    Programa* copia = (Programa*)calloc(1,sizeof(Programa));
+    copia->listas = programa->listas;
+    copia->cantidad = programa->cantidad;
+
+    for(Enunciado* e = programa->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        Enunciado* nuevo = copiarEnunciado(e);
+        //Las variables del programa son las de su ultima declaracion de listas
+        if(e->tipo == ENUNC_DECLARACION_LISTA && e->declaracion.variables == programa->variables)
+            copia->variables = nuevo->declaracion.variables;
+        pushEnunciado(copia,nuevo);
+    }
+
+    return copia;
+}
+
 /**
  * @brief Eliminar Programa
  * @brief funciones_eliminar
@@ -927,6 +1496,7 @@ void eliminarPrograma(Programa* programa) {
                     free(actual->declaracion.variables[i]);
                 }
                 free(actual->declaracion.variables);
+                free(actual->declaracion.enteros);
                 break;
 
             case ENUNC_ASIGNACION:
@@ -937,6 +1507,7 @@ void eliminarPrograma(Programa* programa) {
 
             case ENUNC_LEER:
             case ENUNC_LEER_LISTA:
+            case ENUNC_LEER_TODO:
                 free(actual->leer.variable);
                 break;
 
@@ -966,6 +1537,45 @@ void eliminarPrograma(Programa* programa) {
 
                 eliminarPrograma(actual->mientras.cuerpo);
                 free(actual->mientras.cuerpo);
+                free(actual->mientras.contador);
+                free(actual->mientras.inductor);
+                free(actual->mientras.paralelo);
+                for (int i = 0; i < actual->mientras.cantidadArreglos; i++)
+                    free(actual->mientras.arreglos[i]);
+                free(actual->mientras.arreglos);
+                if (actual->mientras.previo) {
+                    eliminarPrograma(actual->mientras.previo);
+                    free(actual->mientras.previo);
+                }
+                break;
+
+            case ENUNC_ANUNCIAR_LISTA:
+                free(actual->anunciarLista.lista);
+                free(actual->anunciarLista.separador);
+                break;
+
+            case ENUNC_GUARDAR_LISTA:
+            case ENUNC_CARGAR_LISTA:
+                free(actual->archivo.lista);
+                free(actual->archivo.archivo);
+                break;
+
+            case ENUNC_OPERAR_LISTA:
+                free(actual->operar.lista);
+                free(actual->operar.operador);
+                liberarExpresion(actual->operar.expresion);
+                break;
+
+            case ENUNC_ORDENAR:
+                free(actual->ordenar.lista);
+                if (actual->ordenar.parcial)
+                    liberarValor(&actual->ordenar.hasta);
+                break;
+
+            case ENUNC_RESERVAR_LISTA:
+                free(actual->reservar.lista);
+                liberarValor(&actual->reservar.desde);
+                liberarValor(&actual->reservar.hasta);
                 break;
 
             default:
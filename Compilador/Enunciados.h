@@ -8,6 +8,9 @@
  * @author Alexander Arellano Odabachea
  */
 
+#pragma once
+#include "Lexer.h"
+
  /**
   * @brief Estructura que representa un programa(adelanto).
   */
@@ -25,7 +28,14 @@ typedef enum {
     ENUNC_LEER_LISTA, /**< Enunciado de leer una lista */
     ENUNC_ANUNCIAR, /**< Enunciado de anunciar o imprimir */
     ENUNC_SI, /**< Enunciado de si */
-    ENUNC_MIENTRAS /**< Enunciado de mientras */
+    ENUNC_MIENTRAS, /**< Enunciado de mientras */
+    ENUNC_RESERVAR_LISTA, /**< Enunciado que reserva espacio en una lista, lo crea el optimizador */
+    ENUNC_ORDENAR, /**< Enunciado de ordenar una lista */
+    ENUNC_OPERAR_LISTA, /**< Enunciado que opera todos los elementos de una lista con un valor */
+    ENUNC_LEER_TODO, /**< Enunciado de leer toda la entrada en una lista */
+    ENUNC_ANUNCIAR_LISTA, /**< Enunciado de anunciar todos los elementos de una lista */
+    ENUNC_GUARDAR_LISTA, /**< Enunciado de guardar una lista en un archivo binario */
+    ENUNC_CARGAR_LISTA /**< Enunciado de cargar una lista desde un archivo binario */
 } TipoEnunciado;
 
 /**
@@ -46,7 +56,11 @@ typedef enum {
     VAL_LISTA_INDEX_VAR, /**< Valor tipo variable que representa el indice de una lista */
     VAL_LISTA_F, /**< Valor tipo PRIMERO de una lista */
     VAL_LISTA_L, /**< Valor tipo ULTIMO de una lista */
-    VAL_LISTA_S /**< Valor tipo TAMAÑO de una lista */
+    VAL_LISTA_S, /**< Valor tipo TAMAÑO de una lista */
+    VAL_LISTA_T, /**< Valor tipo SUMA de todos los elementos de una lista */
+    VAL_LISTA_N, /**< Valor tipo MINIMO de una lista */
+    VAL_LISTA_X, /**< Valor tipo MAXIMO de una lista */
+    VAL_LISTA_P /**< Valor tipo PRODUCTO PUNTO de dos listas, la segunda se guarda en var */
 } TipoValor;
 /**
  * @brief Tipos de operadores
@@ -69,9 +83,11 @@ typedef enum {
 typedef struct Valor {
     TipoValor tipo; /**< Tipo de valor que es */
     char* nombre; /**< Nombre de la variable si es de tipo variable */
-    float numero; /**< Numero del valor */
+    double numero; /**< Numero del valor */
     int indice;  /**< Indice si es tipo indice */
     char* var; /**< Nombre de la variable */
+    int entero; /**< Booleano para saber si la variable o el indice ya es entero */
+    int seguro; /**< Booleano para saber si el indice siempre esta dentro de la lista */
 } Valor;
 
 /**
@@ -112,6 +128,7 @@ typedef struct Enunciado Enunciado;
 typedef struct {
     char** variables; /**< Variables a inicializar */
     int cantidad; /** Cantidad de variables */
+    int* enteros; /**< Booleano por variable para saber si se declara como entero */
 } Declaracion;
 
 /**
@@ -155,8 +172,61 @@ typedef struct {
 typedef struct {
     Comparacion comp; /**< Comparador */
     Programa* cuerpo; /**< Enunciados del cuerpo de mientras */
+    Programa* previo; /**< Enunciados invariantes que se escriben antes del ciclo */
+    char* contador; /**< Contador entero si es un ciclo contado, NULL si es un while normal */
+    char* inductor; /**< Variable del lenguaje que reemplaza el contador */
+    int paso; /**< Incremento del contador, 1 o -1 */
+    char* paralelo; /**< Clausulas de OpenMP si el ciclo se hace en paralelo, NULL si no */
+    int limiteFijo; /**< Booleano para saber si el limite no cambia en el ciclo y se convierte a entero antes */
+    int independiente; /**< Booleano para saber si ninguna vuelta lee lo que escribe otra, se escribe #pragma GCC ivdep */
+    char** arreglos; /**< Listas que solo se usan por indice o tamaño, su arreglo y tamaño se copian a variables locales */
+    int cantidadArreglos; /**< Cantidad de listas en arreglos */
 } Mientras;
 
+/**
+ * @brief Estructura del tipo reservar, va antes de un ciclo contado que agrega a una lista
+ */
+typedef struct {
+    char* lista; /**< Lista que crece dentro del ciclo */
+    Valor desde; /**< Valor mas chico del contador */
+    Valor hasta; /**< Valor mas grande del contador */
+    int porVuelta; /**< Elementos que se agregan en cada vuelta */
+} Reservar;
+
+/**
+ * @brief Estructura del tipo ordenar
+ */
+typedef struct {
+    char* lista; /**< Lista a ordenar */
+    int parcial; /**< Booleano para ordenar solo los primeros elementos */
+    Valor hasta; /**< Cantidad de elementos a ordenar si es parcial */
+} Ordenar;
+
+/**
+ * @brief Estructura del tipo operar lista
+ */
+typedef struct {
+    char* lista; /**< Lista a operar */
+    char* operador; /**< Operador aritmetico que se aplica a cada elemento */
+    Expresion* expresion; /**< Expresion con la que se opera */
+} Operar;
+
+/**
+ * @brief Estructura del tipo anunciar lista
+ */
+typedef struct {
+    char* lista; /**< Lista a imprimir */
+    char* separador; /**< Cadena que se imprime entre cada elemento, con comillas */
+} AnunciarLista;
+
+/**
+ * @brief Estructura del tipo guardar o cargar lista
+ */
+typedef struct {
+    char* lista; /**< Lista a guardar o cargar */
+    char* archivo; /**< Nombre del archivo, con comillas */
+} ArchivoLista;
+
 /**
  * @brief Estructura del tipo enunciado que contiene el tipo de enunciado
  */
@@ -169,7 +239,14 @@ struct Enunciado {
         Anunciar anunciar;
         Si si;
         Mientras mientras;
+        Reservar reservar;
+        Ordenar ordenar;
+        Operar operar;
+        AnunciarLista anunciarLista;
+        ArchivoLista archivo;
     };
+    int linea; /**< Linea del archivo .wwe donde empieza el enunciado, 0 si lo creo el optimizador */
+    int columna; /**< Columna del archivo .wwe donde empieza el enunciado */
     Enunciado* siguiente; /**< Apuntador al enunciado siguiente */
 };
 
@@ -192,6 +269,8 @@ struct Programa{
  */
 
 void crearEnunciados(Programa* programa, Tokens* tokens);
+int reconstruirEnunciados(Programa* programa, Tokens* tokens, Edicion* edicion);
+int rehacerEnunciados(Programa* programa, Tokens* tokens);
 int esEnunciado(Programa* programa, Tokens* tokens);
 int inicializar(Programa* programa, Tokens* tokens);
 int inicializarLista(Programa* programa, Tokens* tokens);
@@ -201,6 +280,9 @@ int asignacion_lista(Programa* programa, Tokens* tokens);
 int si_trad(Programa *programa,Tokens *tokens);
 int mientras_trad(Programa *programa,Tokens *tokens);
 int anunciar_trad(Programa *programa,Tokens *tokens);
+int ordenar_trad(Programa *programa,Tokens *tokens);
+int operar_trad(Programa *programa,Tokens *tokens);
+int archivo_trad(Programa *programa,Tokens *tokens);
 /** @} */
 
 /**
@@ -218,6 +300,8 @@ OPRelacional tipoOperador(char* operador);
  * @{
  */
 void pushEnunciado(Programa* programa, Enunciado* enunciado);
+int marcarLinea(Programa* programa, Enunciado* anterior, Token* inicio);
+void moverLineas(Enunciado* enunciado, int desplazamiento);
 /** @} */
 
 /**
@@ -226,6 +310,10 @@ void pushEnunciado(Programa* programa, Enunciado* enunciado);
  */
 void liberarExpresion(Expresion* expresion);
 void liberarValor(Valor *valor);
+Valor copiarValor(Valor valor);
+Expresion* copiarExpresion(Expresion* expr);
+Enunciado* copiarEnunciado(Enunciado* enunciado);
+Programa* copiarPrograma(Programa* programa);
 void eliminarPrograma(Programa* programa);
 /** @} */
 
@@ -16,13 +16,13 @@
  * Esta lista de palabras son los inputs permitidos.
  * Hace de simulación de un automata finito.
  */
-const char *inputs[][20] = {
-	{"r","s","n","a","j","m","h","o","-","<","p",ALFABETO,PUNTO,SIGNOS,NUMEROS,IGUAL,COMPARACION,OPARITMETICO,"\""}, //0 A
+const char *inputs[][22] = {
+	{"r","s","n","a","j","m","h","o","-","<","p","g","c",ALFABETO,PUNTO,SIGNOS,NUMEROS,IGUAL,COMPARACION,OPARITMETICO,"\""}, //0 A
 	{ALFABETO,NUMEROS},                                              //1 B NXT
 	{ALFABETO,NUMEROS},                                              //2 C ANUNCIAR
 	{ALFABETO,NUMEROS,"."},                                          //3 D ID poner para que despeus de esto ponga .size o []
 	{NUMEROS},                                                       //4 E
-	{PUNTO,NUMEROS},                                                 //5 F OPARITMETICO
+	{PUNTO,NUMEROS,"="},                                             //5 F OPARITMETICO
 	{"eE",NUMEROS,PUNTO},                                            //6 G NUM
 	{"eE",NUMEROS},                                                  //7 H FLOAT
 	{SIGNOS,NUMEROS},                                                //8 I
@@ -34,7 +34,7 @@ const char *inputs[][20] = {
 	{"d",ALFABETO,NUMEROS},                                          //14  VARIABLE
 	{"y",ALFABETO,NUMEROS},                                          //15  VARIABLE
 	{"r",ALFABETO,NUMEROS},                                          //16  VARIABLE
-	{"t",ALFABETO,NUMEROS},                                          //17  VARIABLE
+	{"t","d",ALFABETO,NUMEROS},                                      //17  VARIABLE AGREGAR PARA ordenar
 	{"o",ALFABETO,NUMEROS},                                          //18  VARIABLE
 	{"n",ALFABETO,NUMEROS},                                          //19  VARIABLE
 	{"m",ALFABETO,NUMEROS},                                          //20  VARIABLE
@@ -72,12 +72,12 @@ const char *inputs[][20] = {
 	{ALFABETO,NUMEROS},                                              //52 JEFF
 	{ALFABETO,NUMEROS},                                              //53 MATT
 	{ALFABETO,NUMEROS},                                              //54 HARDY
-	{">",NUMEROS},                                                   //55 OPARITMETICO
+	{">",NUMEROS,"="},                                               //55 OPARITMETICO
 	{"-","=",">"},                                                   //56 COMPARACION MENOR QUE
 	{},                                                              //57 INICIO-ANUNCIAR
 	{},                                                              //58 FIN-ANUNCIAR
 	{"="},                                                           //59 COMPARACION
-	{},               						 //60 OPARITMETICO
+	{"="},               						 //60 OPARITMETICO
 	{},                                                              //61 COMPARACION IGUAL QUE
 	{"\"",ALFABETO,NUMEROS," ",SIGNOS,OPARITMETICO,COMPARACION,PUNTO,PUNTUACION,IGUAL,ESPECIALES},//62 
 	{},               						 //63 STRING
@@ -85,7 +85,7 @@ const char *inputs[][20] = {
 	{"u",ALFABETO,NUMEROS},             				 //65 VARIABLE
 	{"s",ALFABETO,NUMEROS},                                          //66 VARIABLE
 	{ALFABETO,NUMEROS},           					 //67 NEXUS
-	{"s","l","f"},					                 //68
+	{"s","l","f","t","n","x","p"},			                 //68
 	{},								 //69 SIZE
 	{},              						 //70 LAST
 	{},								 //71 FIRST
@@ -93,20 +93,44 @@ const char *inputs[][20] = {
 	{"o",ALFABETO,NUMEROS},						 //73 VARIABLE
 	{"m",ALFABETO,NUMEROS},						 //74 VARIABLE
 	{"o",ALFABETO,NUMEROS},						 //75 VARIABLE
-	{}};								 //76 PROMO
+	{"s",ALFABETO,NUMEROS},						 //76 PROMO
+	{"e",ALFABETO,NUMEROS},						 //77 VARIABLE
+	{"n",ALFABETO,NUMEROS},						 //78 VARIABLE
+	{"a",ALFABETO,NUMEROS},						 //79 VARIABLE
+	{"r",ALFABETO,NUMEROS},						 //80 VARIABLE
+	{ALFABETO,NUMEROS},						 //81 ORDENAR
+	{},								 //82 SUM
+	{},								 //83 MIN
+	{},								 //84 MAX
+	{},								 //85 DOT
+	{},								 //86 OPASIGNACION
+	{ALFABETO,NUMEROS},						 //87 PROMOS
+	{"u",ALFABETO,NUMEROS},						 //88 VARIABLE
+	{"a",ALFABETO,NUMEROS},						 //89 VARIABLE
+	{"r",ALFABETO,NUMEROS},						 //90 VARIABLE
+	{"d",ALFABETO,NUMEROS},						 //91 VARIABLE
+	{"a",ALFABETO,NUMEROS},						 //92 VARIABLE
+	{"r",ALFABETO,NUMEROS},						 //93 VARIABLE
+	{ALFABETO,NUMEROS},						 //94 GUARDAR
+	{"a",ALFABETO,NUMEROS},						 //95 VARIABLE
+	{"r",ALFABETO,NUMEROS},						 //96 VARIABLE
+	{"g",ALFABETO,NUMEROS},						 //97 VARIABLE
+	{"a",ALFABETO,NUMEROS},						 //98 VARIABLE
+	{"r",ALFABETO,NUMEROS},						 //99 VARIABLE
+	{ALFABETO,NUMEROS}};						 //100 CARGAR
 
 	/**
 	 * @brief Movimientos permitidos
 	 * 
 	 * Tiene la secuencia de caracteres permitida
 	 */
-const int mov2[][20] = {
-	{11,20,45,38,28,31,34,16,55,56,72,3,68,5,6,47,59,60,62}, //A 0
+const int mov2[][22] = {
+	{11,20,45,38,28,31,34,16,55,56,72,88,95,3,68,5,6,47,59,60,62}, //A 0
 	{3,3},                                //B 1
 	{3,3},                                //C 2
 	{3,3,68},                             //D 3
 	{7},                                  //E 4
-	{4,6},                                //F 5
+	{4,6,86},                             //F 5
 	{8,6,7},                              //G 6
 	{8,7},                                //H 7
 	{9,10},                               //I 8
@@ -118,7 +142,7 @@ const int mov2[][20] = {
 	{15,3,3},                             //  14
 	{50,3,3},                             //  15
         {17,3,3},                             //  16
-	{18,3,3},                             //  17
+	{18,77,3,3},                          //  17
 	{19,3,3},                             //  18
 	{51,3,3},                             //  19
 	{21,3,3},                             //  20
@@ -156,12 +180,12 @@ const int mov2[][20] = {
 	{3,3},                                //  52
 	{3,3},                                //  53
 	{3,3},                                //  54
-	{57,6},                               //  55
+	{57,6,86},                            //  55
 	{58,61,61},                           //  56
 	{},                                   //  57
 	{},                                   //  58
 	{61},                                 //  59
-	{},                                   //  60
+	{86},                                 //  60
 	{},                                   //  61
 	{63,62,62,62,62,62,62,62,62,62,62},   //  62
 	{},                                   //  63
@@ -169,7 +193,7 @@ const int mov2[][20] = {
 	{66,3,3}, 			      //  65
 	{67,3,3},                             //  66
 	{3,3},   			      //  67
-	{69,70,71},		              //  68
+	{69,70,71,82,83,84,85},	              //  68
 	{},        			      //  69
 	{},				      //  70
 	{},				      //  71
@@ -177,7 +201,31 @@ const int mov2[][20] = {
 	{74,3,3},			      //  73
 	{75,3,3},          	   	      //  74
 	{76,3,3},			      //  75
-	{}};				      //  76
+	{87,3,3},			      //  76
+	{78,3,3},			      //  77
+	{79,3,3},			      //  78
+	{80,3,3},			      //  79
+	{81,3,3},			      //  80
+	{3,3},				      //  81
+	{},				      //  82
+	{},				      //  83
+	{},				      //  84
+	{},				      //  85
+	{},				      //  86
+	{3,3},				      //  87
+	{89,3,3},			      //  88
+	{90,3,3},			      //  89
+	{91,3,3},			      //  90
+	{92,3,3},			      //  91
+	{93,3,3},			      //  92
+	{94,3,3},			      //  93
+	{3,3},				      //  94
+	{96,3,3},			      //  95
+	{97,3,3},			      //  96
+	{98,3,3},			      //  97
+	{99,3,3},			      //  98
+	{100,3,3},			      //  99
+	{3,3}};				      //  100
 
 
 /**
@@ -246,7 +294,7 @@ Token* isToken(int finalState) {
 	
 	Token *token = (Token*)malloc(sizeof(Token));
 	
-	if((finalState >= 11 && finalState <= 46) || (finalState >= 64 && finalState <= 66) || (finalState >= 72 && finalState <= 75))
+	if((finalState >= 11 && finalState <= 46) || (finalState >= 64 && finalState <= 66) || (finalState >= 72 && finalState <= 75) || (finalState >= 77 && finalState <= 80) || (finalState >= 88 && finalState <= 93) || (finalState >= 95 && finalState <= 99))
 	{
 		//printf("Token: VARIABLE\n");
 		token->tipoToken = strdup("VARIABLE");
@@ -351,6 +399,33 @@ Token* isToken(int finalState) {
 		case 76:
 			cadena = strdup("PROMO");
 			break;
+		case 81:
+			cadena = strdup("ORDENAR");
+			break;
+		case 82:
+			cadena = strdup("SUM");
+			break;
+		case 83:
+			cadena = strdup("MIN");
+			break;
+		case 84:
+			cadena = strdup("MAX");
+			break;
+		case 85:
+			cadena = strdup("DOT");
+			break;
+		case 86:
+			cadena = strdup("OPASIGNACION");
+			break;
+		case 87:
+			cadena = strdup("PROMOS");
+			break;
+		case 94:
+			cadena = strdup("GUARDAR");
+			break;
+		case 100:
+			cadena = strdup("CARGAR");
+			break;
 		default:
 			//printf("Token: NOT_TOKEN\n");
 			cadena = strdup("NOT_TOKEN");
@@ -388,7 +463,6 @@ Token* lexer(char *str)
 
 		//if(currentState == ERROR) {
 		if(currentState == -1) {
-			printf("Token: NOT_TOKEN\n");
 			break;
 		}
 
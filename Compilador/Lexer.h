@@ -42,7 +42,7 @@
 #define OPARITMETICO "*/%"
 
 /** Caracteres permitidos de puntuacion para los strings */
-#define PUNTUACION "!@#$&()?¿¡[]{};:\\\'"
+#define PUNTUACION "!@#$&()?¿¡[]{};:,\\\'"
 
 /** Caracteres especiales */
 #define ESPECIALES "\n\t"
@@ -57,6 +57,8 @@ typedef struct token
 {
 	char* tipoToken; /**< Nombre del tipo de token que es */
 	char* cadena; /**< Palabra almacenada del token */
+	int linea; /**< Linea del archivo donde se encontro el token */
+	int columna; /**< Columna del archivo donde empieza el token, empezando en 1 */
 }Token;
 
 /**
@@ -71,6 +73,20 @@ typedef struct nodo
 	struct nodo *prev; /**< Apuntador al token anterior */
 }Nodo;
 
+/**
+ * @brief Estructura edicion
+ * 
+ * Lineas que cambiaron entre un texto y el siguiente. Las lineas desde linea hasta
+ * linea + anteriores - 1 del texto anterior se cambiaron por las lineas desde linea
+ * hasta linea + nuevas - 1 del texto nuevo, las demas son iguales.
+ */
+typedef struct edicion
+{
+	int linea; /**< Primera linea que cambio, igual en los dos textos */
+	int anteriores; /**< Cantidad de lineas que cambiaron en el texto anterior */
+	int nuevas; /**< Cantidad de lineas que las reemplazan en el texto nuevo */
+}Edicion;
+
 /**
  * @brief Estructura de tokens
  * 
@@ -85,8 +101,8 @@ typedef struct tokens
 }Tokens;
 
 //Inputs que acepta cada estado
-extern const char *inputs[][20];
-extern const int mov2[][20]; 
+extern const char *inputs[][22];
+extern const int mov2[][22]; 
 
 //char nextState(char currentState, char input);
 /**
@@ -107,8 +123,11 @@ Token* lexer(char *str);
  * @{
  */
 void incializarTokens(Tokens *tokens);
-Nodo* crearNodo();
+Nodo* crearNodo(Token *token, int linea, int columna);
 void borrarLista(Tokens *tokens);
-void lexerAnalysis(char *filename,Tokens *tokens);
+void lexerAnalysis(FILE *file,Tokens *tokens);
+void lexerLineas(FILE *file,Tokens *tokens,int primeraLinea);
+void cortarLista(Tokens *tokens, Nodo *desde);
+int relexar(Tokens *tokens, const char* anterior, size_t tamAnterior, const char* fuente, size_t tam, Edicion *edicion);
 void inicializarTokens(Tokens *tokens);
 /**@} */
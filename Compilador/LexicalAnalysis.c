@@ -20,9 +20,13 @@
 
 int encontrado(char c, char* lista);
 int esValido(char c,int *string);
-Nodo* crearNodo(Token *token);
+Nodo* crearNodo(Token *token, int linea, int columna);
 void insertarNodo(Tokens *tokens, Nodo *nodo);
 void printTokens(Tokens *tokens);
+void liberarNodo(Nodo *nodo);
+void lexerTexto(const char* texto, size_t tam, Tokens *tokens, int primeraLinea);
+int cadenaAbierta(Token *token);
+int contarLineas(const char* texto, size_t tam);
 
 /**
  * @brief encontrado
@@ -86,27 +90,38 @@ int esValido(char c,int *string)
  * Este método revisa todo un archivo y pasa cada palabra que encuentre
  * al tokenizer para ir haciendo la lista de tokens
  * Ignora los comentarios
+ * El archivo lo abre y lo cierra quien llama, puede ser un archivo en memoria
  * 
- * @param filename Nombre del archivo a revisar
+ * @param file Archivo a revisar, abierto para leer
  * @param tokens Lista de tokens donde se agregaran los tokens encontrados
  */
-void lexerAnalysis(char *filename,Tokens *tokens)
+void lexerAnalysis(FILE *file,Tokens *tokens)
 {
-	int cantLineas = 0;
-	FILE *file;
+	lexerLineas(file,tokens,1);
+}
+
+/**
+ * @brief Análisis Léxico desde una linea
+ * @ingroup lexer
+ * 
+ * Igual que lexerAnalysis, pero el archivo empieza en la linea indicada del programa,
+ * para agregar los tokens de un pedazo del programa a los que ya se tenian
+ * 
+ * @param file Archivo a revisar, abierto para leer al inicio de una linea
+ * @param tokens Lista de tokens donde se agregaran los tokens encontrados
+ * @param primeraLinea Linea del programa donde empieza el archivo
+ */
+void lexerLineas(FILE *file,Tokens *tokens,int primeraLinea)
+{
+	int cantLineas = primeraLinea - 1;
+	long inicioLinea = 0;
+	int columna;
 
 	char word[100];
 	int i;
 	char c,prev;
 	int comentario = 0, string = false, variable = 0;
 
-	file = fopen(filename,"r");
-	if(file == NULL)
-	{
-		printf("Error opening file.\n");
-		return;
-	}
-
 	while((c = fgetc(file)) != EOF)
 	{
 
@@ -120,16 +135,19 @@ void lexerAnalysis(char *filename,Tokens *tokens)
 
 		if(c == '\n')
 		{
-			cantLineas++;
 			comentario = 0;
 			Token *token = (Token*)malloc(sizeof(Token));
 			token->tipoToken = strdup("FIN-LINEA");
 			token->cadena = strdup(" ");
-			Nodo *nuevoNodo = crearNodo(token);
+			Nodo *nuevoNodo = crearNodo(token,cantLineas + 1,ftell(file) - inicioLinea);
 			insertarNodo(tokens,nuevoNodo);
+			cantLineas++;
+			inicioLinea = ftell(file);
 			continue;
 		}
 		
+		//c ya se leyo, la columna es la de c empezando en 1
+		columna = ftell(file) - inicioLinea;
 		if(c == '"')
 		{
 			string = true;
@@ -142,7 +160,8 @@ void lexerAnalysis(char *filename,Tokens *tokens)
 			prev = c;
 			word[i++] = c;
 			c = fgetc(file);
-			if(c == '.' && !isdigit(prev))
+			//Dentro de una cadena el punto no separa palabras
+			if(c == '.' && !isdigit(prev) && !string)
 			{
 				variable = 1;
 				break;
@@ -157,13 +176,14 @@ void lexerAnalysis(char *filename,Tokens *tokens)
 				Token *token = lexer(word);
 				token->cadena = (char*)calloc(i+1,sizeof(char));
 				strcpy(token->cadena,word);
-				Nodo* nuevoNodo = crearNodo(token);
+				Nodo* nuevoNodo = crearNodo(token,cantLineas + 1,columna);
 				insertarNodo(tokens,nuevoNodo);
 			}
 		}	
 		i = 0;
 		if(variable)
 		{
+			columna = ftell(file) - inicioLinea;
 			while(esValido(c,&string))
 			{
 				word[i++] = c;
@@ -175,7 +195,7 @@ void lexerAnalysis(char *filename,Tokens *tokens)
 				Token *token = lexer(word);
 				token->cadena = (char*)calloc(i+1,sizeof(char));
 				strcpy(token->cadena,word);
-				Nodo* nuevoNodo = crearNodo(token);
+				Nodo* nuevoNodo = crearNodo(token,cantLineas + 1,columna);
 				insertarNodo(tokens,nuevoNodo);
 			}
 			variable = 0;
@@ -187,7 +207,7 @@ void lexerAnalysis(char *filename,Tokens *tokens)
 			Token *token = (Token*)malloc(sizeof(Token));
 			token->tipoToken = strdup("LBRACKET");
 			token->cadena = strdup("[");
-			Nodo *nuevoNodo = crearNodo(token);
+			Nodo *nuevoNodo = crearNodo(token,cantLineas + 1,ftell(file) - inicioLinea);
 			insertarNodo(tokens,nuevoNodo);
 			continue;
 		}
@@ -199,25 +219,27 @@ void lexerAnalysis(char *filename,Tokens *tokens)
 			Token *token = (Token*)malloc(sizeof(Token));
 			token->tipoToken = strdup("RBRACKET");
 			token->cadena = strdup("]");
-			Nodo *nuevoNodo = crearNodo(token);
+			Nodo *nuevoNodo = crearNodo(token,cantLineas + 1,ftell(file) - inicioLinea);
 			insertarNodo(tokens,nuevoNodo);
 			continue;
 		}
 
+		//El comentario termina con la linea aunque el salto venga despues de una palabra
 		if(c == '\n')
 		{
+			comentario = 0;
 			Token *token = (Token*)malloc(sizeof(Token));
 			token->tipoToken = strdup("FIN-LINEA");
 			token->cadena = strdup(" ");
-			Nodo *nuevoNodo = crearNodo(token);
+			Nodo *nuevoNodo = crearNodo(token,cantLineas + 1,ftell(file) - inicioLinea);
 			insertarNodo(tokens,nuevoNodo);
 			cantLineas++;
+			inicioLinea = ftell(file);
 			//break;
 		}
 	}
 	//printTokens(tokens);
 	//borrarLista(tokens);
-	fclose(file);
 }
 
 /**
@@ -227,12 +249,16 @@ void lexerAnalysis(char *filename,Tokens *tokens)
  * Este método crea un token para la lista enlazada de tokens
  * 
  * @param token Token a agregar
+ * @param linea Linea del archivo donde esta el token
+ * @param columna Columna del archivo donde empieza el token
  * 
  * @return Nodo* Apuntador al nuevo nodo
  */
-Nodo* crearNodo(Token *token)
+Nodo* crearNodo(Token *token, int linea, int columna)
 {
 	Nodo *nuevoNodo = (Nodo*)malloc(sizeof(Nodo));
+	token->linea = linea;
+	token->columna = columna;
 	nuevoNodo->token = token;
 	nuevoNodo->next = NULL;
 	nuevoNodo->next = NULL;
@@ -293,27 +319,274 @@ void borrarLista(Tokens *tokens)
 	Nodo *nodo = tokens->fin;
 	for(int i = tokens->cant; i > 0; i--)
 	{
-		if (nodo->token->tipoToken != NULL) {
-    		free(nodo->token->tipoToken); // Liberar solo si no es NULL
-    		nodo->token->tipoToken = NULL; // Asegurar que no se libere dos veces
+		tokens->fin = tokens->fin->prev;
+		liberarNodo(nodo);
+		nodo = tokens->fin;
+	}
+}
+
+/**
+ * @brief Cortar lista
+ * @ingroup lexer
+ * 
+ * Borra el nodo indicado y todos los que siguen, los anteriores se quedan
+ * 
+ * @param tokens Lista enlazada de tokens
+ * @param desde Primer nodo a borrar
+ */
+void cortarLista(Tokens *tokens, Nodo *desde)
+{
+	while(tokens->cant > 0)
+	{
+		Nodo *nodo = tokens->fin;
+		//El primer nodo tiene como anterior a si mismo
+		tokens->fin = nodo == tokens->inicio ? NULL : nodo->prev;
+		tokens->cant--;
+		liberarNodo(nodo);
+		if(nodo == desde)
+			break;
+	}
+
+	if(tokens->fin)
+		tokens->fin->next = NULL;
+	else
+		tokens->inicio = NULL;
+	tokens->actual = tokens->inicio;
+}
+
+/**
+ * @brief Re-lexar
+ * @ingroup lexer
+ * 
+ * Actualiza la lista de tokens de un texto anterior para que sea la del texto nuevo.
+ * Los tokens de las lineas antes del primer caracter distinto y los de las lineas
+ * despues del ultimo se quedan, a los del final solo se les cambia la linea, y se
+ * revisan solo las lineas de en medio. Si una cadena sin cerrar sigue en la linea
+ * del cambio se revisa todo el texto, y si queda abierta en medio se revisa hasta
+ * el final.
+ * 
+ * @param tokens Lista de tokens del texto anterior, vacia si no hay anterior
+ * @param anterior Texto anterior, NULL si no hay
+ * @param tamAnterior Tamaño del texto anterior
+ * @param fuente Texto nuevo
+ * @param tam Tamaño del texto nuevo
+ * @param edicion Donde se guardan las lineas que se volvieron a revisar, puede ser NULL
+ * 
+ * @return int Cantidad de tokens que se reutilizaron
+ */
+int relexar(Tokens *tokens, const char* anterior, size_t tamAnterior, const char* fuente, size_t tam, Edicion *edicion)
+{
+	size_t comun = 0;
+	if(anterior)
+		while(comun < tam && comun < tamAnterior && anterior[comun] == fuente[comun])
+			comun++;
+
+	//Se vuelve a revisar desde el inicio de la linea del primer cambio
+	size_t inicio = 0;
+	int linea = 1;
+	for(size_t i = 0; i < comun; i++)
+		if(fuente[i] == '\n')
+		{
+			inicio = i + 1;
+			linea++;
+		}
+
+	//Los caracteres iguales del final pueden llegar hasta el inicio de esa linea
+	size_t sufijo = 0;
+	if(anterior)
+		while(inicio + sufijo < tam && inicio + sufijo < tamAnterior
+			&& anterior[tamAnterior - sufijo - 1] == fuente[tam - sufijo - 1])
+			sufijo++;
+
+	Nodo *nodo = tokens->inicio;
+	int reutilizados = 0;
+	while(nodo != NULL && reutilizados < tokens->cant && nodo->token->linea < linea)
+	{
+		if(cadenaAbierta(nodo->token))
+		{
+			nodo = tokens->inicio;
+			reutilizados = 0;
+			inicio = 0;
+			linea = 1;
+			sufijo = 0;
+			break;
 		}
+		nodo = nodo->next;
+		reutilizados++;
+	}
 
-		if(nodo->token->cadena != NULL){
-			free(nodo->token->cadena);
-			nodo->token->cadena = NULL;
+	//Y hasta el inicio de la primera linea que es igual en los dos textos
+	size_t fin = tam, finAnterior = tamAnterior;
+	for(size_t p = tam - sufijo; sufijo > 0 && p < tam; p++)
+	{
+		size_t q = tamAnterior - (tam - p);
+		if(p > 0 && q > 0 && fuente[p - 1] == '\n' && anterior[q - 1] == '\n')
+		{
+			fin = p;
+			finAnterior = q;
+			break;
 		}
+	}
+	int lineaFin = linea + contarLineas(fuente + inicio,fin - inicio);
+	int lineaFinAnterior = linea + (anterior ? contarLineas(anterior + inicio,finAnterior - inicio) : 0);
 
-		if(nodo->token != NULL){
-			free(nodo->token);
-			nodo->token = NULL;
+	//Primer token de las lineas del final, si ninguno de en medio deja una cadena abierta
+	Nodo *siguiente = NULL;
+	int cantSiguiente = tokens->cant - reutilizados;
+	if(fin < tam)
+	{
+		siguiente = nodo;
+		while(cantSiguiente > 0 && siguiente->token->linea < lineaFinAnterior && !cadenaAbierta(siguiente->token))
+		{
+			siguiente = siguiente->next;
+			cantSiguiente--;
 		}
+		if(cantSiguiente == 0 || siguiente->token->linea < lineaFinAnterior)
+			siguiente = NULL;
+	}
 
-		tokens->fin = tokens->fin->prev;
-		free(nodo);
-		nodo = tokens->fin;
+	//Se separan de la lista para que no se borren con los de en medio
+	Nodo *ultimo = tokens->fin;
+	if(siguiente)
+	{
+		if(siguiente == tokens->inicio)
+			inicializarTokens(tokens);
+		else
+		{
+			tokens->fin = siguiente->prev;
+			tokens->fin->next = NULL;
+			tokens->cant -= cantSiguiente;
+		}
+	}
+
+	if(reutilizados < tokens->cant)
+		cortarLista(tokens,nodo);
+	Nodo *previo = tokens->fin;
+
+	lexerTexto(fuente + inicio,(siguiente ? fin : tam) - inicio,tokens,linea);
+
+	if(siguiente)
+	{
+		Nodo *medio = previo ? previo->next : tokens->inicio;
+		int abierta = 0;
+		for(int i = reutilizados; i < tokens->cant && !abierta; i++, medio = medio->next)
+			abierta = cadenaAbierta(medio->token);
+
+		if(abierta)
+		{
+			while(cantSiguiente-- > 0)
+			{
+				Nodo *libre = siguiente;
+				siguiente = siguiente->next;
+				liberarNodo(libre);
+			}
+			siguiente = NULL;
+			cortarLista(tokens,previo ? previo->next : tokens->inicio);
+			lexerTexto(fuente + inicio,tam - inicio,tokens,linea);
+		}
+	}
+
+	if(siguiente)
+	{
+		Nodo *n = siguiente;
+		for(int i = 0; i < cantSiguiente; i++, n = n->next)
+			n->token->linea += lineaFin - lineaFinAnterior;
+		ultimo->next = NULL;
+
+		if(tokens->fin)
+		{
+			tokens->fin->next = siguiente;
+			siguiente->prev = tokens->fin;
+		}
+		else
+		{
+			tokens->inicio = siguiente;
+			siguiente->prev = siguiente;
+		}
+		tokens->fin = ultimo;
+		tokens->cant += cantSiguiente;
+		reutilizados += cantSiguiente;
+	}
+	else
+	{
+		lineaFin = linea + contarLineas(fuente + inicio,tam - inicio) + 1;
+		lineaFinAnterior = anterior ? linea + contarLineas(anterior + inicio,tamAnterior - inicio) + 1 : linea;
+	}
+	tokens->actual = tokens->inicio;
+
+	if(edicion)
+	{
+		edicion->linea = linea;
+		edicion->anteriores = lineaFinAnterior - linea;
+		edicion->nuevas = lineaFin - linea;
+	}
+
+	return reutilizados;
+}
+
+/**
+ * @brief Lexer de un texto
+ * @ingroup lexer
+ * 
+ * Agrega los tokens de un texto en memoria que empieza en la linea indicada
+ * 
+ * @param texto Texto a revisar, empieza al inicio de una linea
+ * @param tam Tamaño del texto
+ * @param tokens Lista de tokens donde se agregaran los tokens encontrados
+ * @param primeraLinea Linea del programa donde empieza el texto
+ */
+void lexerTexto(const char* texto, size_t tam, Tokens *tokens, int primeraLinea)
+{
+	if(tam == 0)
+		return;
+
+	FILE *file = fmemopen((void*)texto,tam,"r");
+	if(file)
+	{
+		lexerLineas(file,tokens,primeraLinea);
+		fclose(file);
 	}
 }
 
+/**
+ * @brief Cadena abierta
+ * @ingroup lexer
+ * 
+ * Revisa si el token es una cadena a la que le falta la comilla del final, despues
+ * de ella el lexer sigue dentro de la cadena
+ * 
+ * @param token Token a revisar
+ * 
+ * @return int Si la cadena esta abierta
+ */
+int cadenaAbierta(Token *token)
+{
+	char *cadena = token->cadena;
+	int largo = strlen(cadena);
+	return cadena[0] == '"' && (largo == 1 || cadena[largo - 1] != '"');
+}
+
+/**
+ * @brief Contar lineas
+ * @ingroup lexer
+ * 
+ * @param texto Texto a revisar
+ * @param tam Tamaño del texto
+ * 
+ * @return int Cantidad de saltos de linea en el texto
+ */
+int contarLineas(const char* texto, size_t tam)
+{
+	int lineas = 0;
+	const char *fin = texto + tam;
+	while(texto < fin && (texto = memchr(texto,'\n',fin - texto)) != NULL)
+	{
+		lineas++;
+		texto++;
+	}
+	return lineas;
+}
+
 /**
  * @brief Imprimir tokens
  * @ingroup lexer
@@ -334,3 +607,31 @@ void printTokens(Tokens *tokens)
 	}
 	tokens->actual = tokens->inicio;
 }
+
+/**
+ * @brief Liberar nodo
+ * @ingroup lexer
+ * 
+ * Libera un nodo con su token, sin quitarlo de la lista
+ * 
+ * @param nodo Nodo a liberar
+ */
+void liberarNodo(Nodo *nodo)
+{
+	if (nodo->token->tipoToken != NULL) {
+		free(nodo->token->tipoToken); // Liberar solo si no es NULL
+		nodo->token->tipoToken = NULL; // Asegurar que no se libere dos veces
+	}
+
+	if(nodo->token->cadena != NULL){
+		free(nodo->token->cadena);
+		nodo->token->cadena = NULL;
+	}
+
+	if(nodo->token != NULL){
+		free(nodo->token);
+		nodo->token = NULL;
+	}
+
+	free(nodo);
+}
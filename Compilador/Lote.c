@@ -0,0 +1,143 @@
+/**
+ * @file Lote.c
+ * @brief Implementación de la compilacion de varios archivos al mismo tiempo.
+ *
+ * Cada hilo toma el siguiente archivo del lote y lo compila completo con su
+ * propio contexto, incluyendo su gcc, asi hay hasta -j gcc corriendo a la vez
+ * mientras otros hilos hacen el lexico y el parser de otros archivos. Listas.c
+ * se compila una sola vez al inicio y todos los programas se ligan con ese objeto.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "Lote.h"
+
+/**@cond */
+void* trabajador(void* argumento);
+/**@endcond */
+
+/**
+ * @brief Compilar lote
+ * @ingroup funciones_lote
+ *
+ * Compila todos los contextos repartiendolos entre los hilos, el hilo principal
+ * tambien compila. Si Listas.o no se pudo compilar cada programa compila Listas.c.
+ *
+ * @param contextos Contexto ya inicializado de cada archivo
+ * @param cantidad Cantidad de archivos
+ * @param hilos Cantidad de compilaciones al mismo tiempo
+ *
+ * @return int Cantidad de archivos que se compilaron sin errores
+ */
+int compilarLote(Contexto* contextos, int cantidad, int hilos)
+{
+    char objeto[64];
+    snprintf(objeto,sizeof(objeto),"wwe_listas_%ld.o",(long)getpid());
+    //Con --connect el servidor ya tiene su Listas.o
+    int listas = !contextos[0].opciones.servidor && compilarListas(&contextos[0].opciones,objeto);
+    if(listas)
+        for(int i = 0; i < cantidad; i++)
+            contextos[i].listas = objeto;
+
+    Lote lote = {contextos,cantidad,0,0};
+    if(hilos > cantidad)
+        hilos = cantidad;
+
+    pthread_t* ids = (pthread_t*)malloc(sizeof(pthread_t) * hilos);
+    int creados = 0;
+    for(; creados < hilos - 1; creados++)
+        if(pthread_create(&ids[creados],NULL,trabajador,&lote) != 0)
+            break;
+
+    trabajador(&lote);
+    for(int i = 0; i < creados; i++)
+        pthread_join(ids[i],NULL);
+    free(ids);
+
+    if(listas)
+        remove(objeto);
+    return lote.correctos;
+}
+
+/**
+ * @brief Compilar Listas
+ * @ingroup funciones_lote
+ *
+ * Compila Listas.c a un objeto con las mismas banderas que los programas.
+ *
+ * @param opciones Opciones de la compilacion, iguales para todo el lote
+ * @param objeto Nombre del archivo .o
+ *
+ * @return int Si se compilo
+ */
+int compilarListas(Opciones* opciones, char* objeto)
+{
+    char* argumentos[16];
+    int n = banderasGcc(opciones,argumentos);
+    argumentos[n++] = "-c";
+    argumentos[n++] = "Listas.c";
+    argumentos[n++] = "-o";
+    argumentos[n++] = objeto;
+    argumentos[n] = NULL;
+
+    struct rusage uso;
+    return ejecutar(argumentos,&uso) == 0;
+}
+
+/**
+ * @brief Nombre de salida
+ * @ingroup funciones_lote
+ *
+ * En un lote el ejecutable se llama como el archivo sin .wwe, dentro de la
+ * carpeta de -o si se dio una.
+ *
+ * @param destino Donde se escribe el nombre
+ * @param tam Tamaño de destino
+ * @param filename Archivo .wwe
+ * @param carpeta Carpeta de los ejecutables, NULL para dejarlos junto al archivo
+ */
+void nombreSalida(char* destino, int tam, char* filename, char* carpeta)
+{
+    char* nombre = filename;
+    if(carpeta)
+    {
+        char* diagonal = strrchr(filename,'/');
+        if(diagonal)
+            nombre = diagonal + 1;
+        snprintf(destino,tam,"%s/%s",carpeta,nombre);
+    }
+    else
+        snprintf(destino,tam,"%s",nombre);
+
+    int largo = strlen(destino);
+    if(largo > 4 && !strcmp(destino + largo - 4,".wwe"))
+        destino[largo - 4] = '\0';
+}
+
+/**@cond */
+
+/*
+ * Toma archivos del lote hasta que ya no quede ninguno
+ */
+void* trabajador(void* argumento)
+{
+    Lote* lote = (Lote*)argumento;
+    int i;
+
+    while((i = __atomic_fetch_add(&lote->siguiente,1,__ATOMIC_RELAXED)) < lote->cantidad)
+    {
+        Contexto* ctx = &lote->contextos[i];
+        if(compilar(ctx))
+            __atomic_add_fetch(&lote->correctos,1,__ATOMIC_RELAXED);
+        else
+            printf("No se pudo compilar %s\n",ctx->filename);
+    }
+
+    return NULL;
+}
+
+/**@endcond */
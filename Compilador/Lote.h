@@ -0,0 +1,31 @@
+/**
+ * @file Lote.h
+ * @brief Prototipos de la compilacion de varios archivos al mismo tiempo.
+ *
+ * Este archivo contiene lo necesario para compilar un lote de archivos .wwe
+ * con -j, repartiendolos entre varios hilos.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+#include "Contexto.h"
+
+/**
+ * @brief Lote de archivos que comparten los hilos
+ */
+typedef struct {
+    Contexto* contextos; /**< Contexto de cada archivo */
+    int cantidad; /**< Cantidad de archivos */
+    int siguiente; /**< Siguiente archivo que no ha tomado ningun hilo */
+    int correctos; /**< Archivos que ya se compilaron sin errores */
+} Lote;
+
+/**
+ * @defgroup funciones_lote Funciones de la compilacion en lote
+ * @{
+ */
+int compilarLote(Contexto* contextos, int cantidad, int hilos);
+int compilarListas(Opciones* opciones, char* objeto);
+void nombreSalida(char* destino, int tam, char* filename, char* carpeta);
+/** @} */
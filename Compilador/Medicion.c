@@ -0,0 +1,233 @@
+/**
+ * @file Medicion.c
+ * @brief Implementación del reporte de tiempos del compilador.
+ *
+ * Mide cada fase de la compilacion para --time-report. La memoria de cada fase es
+ * lo que cambio la memoria reservada con malloc entre su inicio y su final, se lee con
+ * mallinfo2 y es la de todo el proceso, asi con -j incluye lo que reservan los otros hilos.
+ * La CPU es la de cada hilo, asi con -j cada archivo tiene la suya.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <sys/resource.h>
+#include "Medicion.h"
+
+/**@cond */
+static const char* nombresFases[TOTAL_FASES] = {
+    "lexico", "sintactico", "enunciados", "optimizacion", "traduccion", "gcc"
+};
+
+double segundos(struct timespec inicio, struct timespec fin);
+long memoriaReservada();
+void escribirTextoJson(FILE* fptr, const char* texto);
+/**@endcond */
+
+/**
+ * @brief Iniciar fase
+ * @ingroup funciones_medicion
+ *
+ * Guarda el reloj, la CPU y la memoria reservada antes de empezar una fase.
+ *
+ * @param medicion Medicion de la compilacion
+ */
+void iniciarFase(Medicion* medicion)
+{
+    clock_gettime(CLOCK_MONOTONIC,&medicion->pared);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID,&medicion->cpu);
+    medicion->memoria = memoriaReservada();
+}
+
+/**
+ * @brief Terminar fase
+ * @ingroup funciones_medicion
+ *
+ * @param medicion Medicion de la compilacion
+ * @param fase Fase que acaba de terminar en este hilo
+ */
+void terminarFase(Medicion* medicion, Fase fase)
+{
+    struct timespec pared, cpu;
+    clock_gettime(CLOCK_MONOTONIC,&pared);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID,&cpu);
+
+    struct rusage uso;
+    getrusage(RUSAGE_SELF,&uso);
+
+    MedicionFase* m = &medicion->fases[fase];
+    m->pared += segundos(medicion->pared,pared);
+    m->cpu += segundos(medicion->cpu,cpu);
+    m->memoria += memoriaReservada() - medicion->memoria;
+    //ru_maxrss es el maximo de todo el proceso desde que empezo, no el de la fase
+    m->pico = uso.ru_maxrss;
+    m->medida = 1;
+}
+
+/**
+ * @brief Terminar fase externa
+ * @ingroup funciones_medicion
+ *
+ * Igual que terminar fase, pero la CPU y el pico de memoria son los de un proceso hijo,
+ * como gcc, que no se ven en los del compilador.
+ *
+ * @param medicion Medicion de la compilacion
+ * @param fase Fase que acaba de terminar en otro proceso
+ * @param uso Recursos del proceso hijo que regreso wait4, NULL si no se pudo crear
+ */
+void terminarFaseExterna(Medicion* medicion, Fase fase, struct rusage* uso)
+{
+    terminarFase(medicion,fase);
+
+    MedicionFase* m = &medicion->fases[fase];
+    m->cpu = 0;
+    m->pico = 0;
+    if(uso)
+    {
+        m->cpu = (double)(uso->ru_utime.tv_sec + uso->ru_stime.tv_sec) + (double)(uso->ru_utime.tv_usec + uso->ru_stime.tv_usec) / 1e6;
+        m->pico = uso->ru_maxrss;
+    }
+}
+
+/**
+ * @brief Contar simbolos
+ * @ingroup funciones_medicion
+ *
+ * @param pila Tabla de simbolos con todos sus scopes
+ *
+ * @return int Cantidad de variables en todos los scopes
+ */
+int contarSimbolos(Pila* pila)
+{
+    int cantidad = 0;
+    for(NodoPila* actual = pila->head; actual != NULL; actual = actual->next)
+        cantidad += actual->scope->numOfElements;
+    return cantidad;
+}
+
+/**
+ * @brief Contar enunciados
+ * @ingroup funciones_medicion
+ *
+ * @param bloque Bloque a contar
+ *
+ * @return int Cantidad de enunciados del bloque y de sus bloques internos
+ */
+int contarEnunciados(Programa* bloque)
+{
+    int cantidad = 0;
+    if(!bloque)
+        return 0;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        cantidad++;
+        if(e->tipo == ENUNC_SI)
+            cantidad += contarEnunciados(e->si.entonces) + contarEnunciados(e->si.si_no);
+        else if(e->tipo == ENUNC_MIENTRAS)
+            cantidad += contarEnunciados(e->mientras.previo) + contarEnunciados(e->mientras.cuerpo);
+    }
+
+    return cantidad;
+}
+
+/**
+ * @brief Imprimir medicion
+ * @ingroup funciones_medicion
+ *
+ * Escribe una tabla con cada fase que corrio y el total, o lo mismo en un objeto JSON.
+ *
+ * @param medicion Medicion de la compilacion
+ * @param fptr Archivo donde se escribe el reporte
+ * @param json Booleano para escribir JSON en vez de la tabla
+ */
+void imprimirMedicion(Medicion* medicion, FILE* fptr, int json)
+{
+    MedicionFase total = {0};
+    for(int i = 0; i < TOTAL_FASES; i++)
+    {
+        MedicionFase* m = &medicion->fases[i];
+        total.pared += m->pared;
+        total.cpu += m->cpu;
+        total.memoria += m->memoria;
+        if(m->pico > total.pico)
+            total.pico = m->pico;
+    }
+
+    if(json)
+    {
+        fprintf(fptr,"{\"archivo\":");
+        escribirTextoJson(fptr,medicion->archivo ? medicion->archivo : "");
+        fprintf(fptr,",\"fases\":[");
+        int primera = 1;
+        for(int i = 0; i < TOTAL_FASES; i++)
+        {
+            MedicionFase* m = &medicion->fases[i];
+            if(!m->medida)
+                continue;
+            fprintf(fptr,"%s{\"fase\":\"%s\",\"pared\":%.6f,\"cpu\":%.6f,\"memoria_bytes\":%ld,\"pico_proceso_kb\":%ld}",
+                primera ? "" : ",",nombresFases[i],m->pared,m->cpu,m->memoria,m->pico);
+            primera = 0;
+        }
+        fprintf(fptr,"],\"total\":{\"pared\":%.6f,\"cpu\":%.6f,\"memoria_bytes\":%ld,\"pico_proceso_kb\":%ld},",
+            total.pared,total.cpu,total.memoria,total.pico);
+        fprintf(fptr,"\"tokens\":%d,\"simbolos\":%d,\"enunciados\":%d}\n",medicion->tokens,medicion->simbolos,medicion->enunciados);
+        return;
+    }
+
+    if(medicion->archivo)
+        fprintf(fptr,"Archivo: %s\n",medicion->archivo);
+    fprintf(fptr,"%-14s %10s %10s %12s %18s\n","Fase","Pared(s)","CPU(s)","Memoria(B)","PicoProceso(KB)");
+    for(int i = 0; i < TOTAL_FASES; i++)
+    {
+        MedicionFase* m = &medicion->fases[i];
+        if(m->medida)
+            fprintf(fptr,"%-14s %10.6f %10.6f %12ld %18ld\n",nombresFases[i],m->pared,m->cpu,m->memoria,m->pico);
+    }
+    fprintf(fptr,"%-14s %10.6f %10.6f %12ld %18ld\n","total",total.pared,total.cpu,total.memoria,total.pico);
+    fprintf(fptr,"Tokens: %d  Simbolos: %d  Enunciados: %d\n",medicion->tokens,medicion->simbolos,medicion->enunciados);
+}
+
+/**@cond */
+
+/*
+ * Segundos entre dos lecturas del reloj
+ */
+double segundos(struct timespec inicio, struct timespec fin)
+{
+    return (double)(fin.tv_sec - inicio.tv_sec) + (double)(fin.tv_nsec - inicio.tv_nsec) / 1e9;
+}
+
+/*
+ * Bytes reservados con malloc que siguen en uso en todo el proceso, 0 si glibc no tiene mallinfo2
+ */
+long memoriaReservada()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    return (long)mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Escribe el texto entre comillas, escapando las comillas, las diagonales invertidas y los caracteres de control
+ */
+void escribirTextoJson(FILE* fptr, const char* texto)
+{
+    fputc('"',fptr);
+    for(const unsigned char* c = (const unsigned char*)texto; *c; c++)
+    {
+        if(*c == '"' || *c == '\\')
+            fprintf(fptr,"\\%c",*c);
+        else if(*c < 0x20)
+            fprintf(fptr,"\\u%04x",*c);
+        else
+            fputc(*c,fptr);
+    }
+    fputc('"',fptr);
+}
+
+/**@endcond */
@@ -0,0 +1,67 @@
+/**
+ * @file Medicion.h
+ * @brief Prototipos y estructuras del reporte de tiempos del compilador.
+ *
+ * Este archivo contiene lo necesario para medir el tiempo, la memoria
+ * reservada y la memoria maxima del proceso en cada fase de la compilacion con
+ * la opcion --time-report.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+#include <stdio.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "SymbolTable.h"
+#include "Enunciados.h"
+
+/**
+ * @brief Fases de la compilacion que se miden
+ */
+typedef enum {
+    FASE_LEXICO, /**< Lectura del archivo y tokens */
+    FASE_SINTACTICO, /**< Parser y tabla de simbolos */
+    FASE_ENUNCIADOS, /**< Creacion de los enunciados */
+    FASE_OPTIMIZACION, /**< Optimizador y analisis de rangos, vectores y paralelos */
+    FASE_TRADUCCION, /**< Escritura del archivo .c */
+    FASE_GCC, /**< Compilacion del archivo .c con gcc */
+    TOTAL_FASES /**< Cantidad de fases */
+} Fase;
+
+/**
+ * @brief Lo medido en una fase
+ */
+typedef struct {
+    double pared; /**< Segundos de reloj */
+    double cpu; /**< Segundos de CPU del hilo de la compilacion, en gcc son los de sus procesos */
+    long memoria; /**< Bytes que la fase dejo reservados con malloc, negativo si libero mas de lo que reservo */
+    long pico; /**< Memoria residente maxima en KB de todo el proceso hasta el final de la fase, en gcc la de su proceso mas grande */
+    int medida; /**< Booleano para saber si la fase llego a correr */
+} MedicionFase;
+
+/**
+ * @brief Reporte completo de la compilacion
+ */
+typedef struct {
+    const char* archivo; /**< Archivo .wwe medido */
+    MedicionFase fases[TOTAL_FASES]; /**< Medicion de cada fase */
+    int tokens; /**< Cantidad de tokens del programa */
+    int simbolos; /**< Cantidad de variables en la tabla de simbolos */
+    int enunciados; /**< Cantidad de enunciados, contando los de bloques internos */
+    struct timespec pared; /**< Reloj al iniciar la fase actual */
+    struct timespec cpu; /**< CPU del hilo al iniciar la fase actual */
+    long memoria; /**< Bytes reservados con malloc al iniciar la fase actual */
+} Medicion;
+
+/**
+ * @defgroup funciones_medicion Funciones del reporte de tiempos
+ * @{
+ */
+void iniciarFase(Medicion* medicion);
+void terminarFase(Medicion* medicion, Fase fase);
+void terminarFaseExterna(Medicion* medicion, Fase fase, struct rusage* uso);
+int contarSimbolos(Pila* pila);
+int contarEnunciados(Programa* bloque);
+void imprimirMedicion(Medicion* medicion, FILE* fptr, int json);
+/** @} */
@@ -0,0 +1,51 @@
+/**
+ * @file Opciones.h
+ * @brief Opciones de compilacion recibidas desde la linea de comandos.
+ *
+ * Este archivo contiene la estructura con las opciones que modifican
+ * la forma en la que se traduce el programa. Cada contexto lleva su
+ * propia copia de las opciones.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+
+/**
+ * @brief Tipo de numero que usan las variables y las listas del programa traducido
+ */
+typedef enum {
+    NUM_FLOAT, /**< Flotante de 32 bits, el tipo original del lenguaje */
+    NUM_DOUBLE, /**< Flotante de 64 bits */
+    NUM_INT64 /**< Entero de 64 bits, la division se vuelve entera */
+} TipoNumero;
+
+/**
+ * @brief Forma de escribir el reporte de tiempos de la compilacion
+ */
+typedef enum {
+    REPORTE_NINGUNO, /**< No se mide nada */
+    REPORTE_TABLA, /**< Tabla para leerse en la terminal */
+    REPORTE_JSON /**< Objeto JSON para otros programas */
+} TipoReporte;
+
+/**
+ * @brief Opciones de compilacion
+ */
+typedef struct {
+    TipoNumero numero; /**< Tipo de numero elegido con --numeric */
+    int checked; /**< Booleano para revisar los indices de las listas con --checked */
+    int ordenamientos; /**< Booleano para cambiar los ordenamientos escritos a mano por ordenar con --sort-idioms */
+    int paralelo; /**< Booleano para hacer los ciclos independientes con varios hilos con --parallel */
+    TipoReporte reporte; /**< Reporte de tiempos elegido con --time-report */
+    int perfil; /**< Booleano para contar las veces y el tiempo de cada linea del programa con --profile */
+    int depuracion; /**< Booleano para compilar con la informacion de depuracion de gcc con -g */
+    int hilos; /**< Archivos que se compilan al mismo tiempo con -j */
+    const char* servidor; /**< Socket del servidor que compila con --connect, NULL para compilar aqui */
+    int vigilar; /**< Booleano para volver a compilar cada vez que cambia el archivo con --watch */
+} Opciones;
+
+/**
+ * @brief Opciones sin ninguna bandera: float, sin revisiones ni reporte, un solo hilo y sin servidor
+ */
+#define OPCIONES_DEFECTO {NUM_FLOAT,0,0,0,REPORTE_NINGUNO,0,0,1,NULL,0}
@@ -0,0 +1,1356 @@
+/**
+ * @file Optimizador.c
+ * @brief Implementación de las pasadas de optimizacion.
+ *
+ * Recorre la lista de enunciados ya creada y la transforma
+ * para que el codigo en C generado sea mas rapido, sin cambiar
+ * lo que hace el programa.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include "Optimizador.h"
+#include "Patrones.h"
+
+/**@cond */
+void subirExpresiones(Optimizador* opt, Enunciado* ciclo, Programa* bloque, Modificaciones* mod);
+void subirExpresion(Optimizador* opt, Enunciado* ciclo, Expresion** expr, Modificaciones* mod);
+void subirHojas(Optimizador* opt, Enunciado* ciclo, Expresion* expr, Modificaciones* mod);
+void subirValor(Optimizador* opt, Enunciado* ciclo, Valor* val, Modificaciones* mod, int condicion);
+void moverPrevios(Enunciado* ciclo, Programa* bloque, Modificaciones* mod);
+char* nuevoTemporal(Optimizador* opt, Enunciado* ciclo, Expresion* expr);
+void marcarValor(Valor* val, Conjunto* enteros);
+void marcarExpresion(Expresion* expr, Conjunto* enteros);
+/**@endcond */
+
+/**
+ * @brief Optimizar programa
+ * @ingroup funciones_optimizador
+ *
+ * Punto de entrada del optimizador, aplica todas las pasadas a la lista de enunciados
+ * y al final marca las variables que se pueden declarar como enteros.
+ * Con --sort-idioms primero cambia los ordenamientos escritos a mano por ordenar.
+ *
+ * @param programa Lista de enunciados completa
+ * @param opciones Opciones de la compilacion
+ */
+void optimizarPrograma(Programa* programa, Opciones* opciones)
+{
+    if(opciones->ordenamientos)
+        reconocerOrdenamientos(programa,1);
+
+    Optimizador opt = {0};
+    inferirEnteros(programa,&opt.enteros);
+
+    Conjunto enteros = {0};
+    optimizarBloque(&opt,programa,&enteros);
+    liberarConjunto(&enteros);
+    liberarConjunto(&opt.enteros);
+
+    //Los temporales nuevos tambien pueden ser enteros, por eso se infiere de nuevo al final
+    inferirEnteros(programa,&enteros);
+    marcarEnteros(programa,&enteros);
+    liberarConjunto(&enteros);
+}
+
+/**
+ * @brief Optimizar bloque
+ * @ingroup funciones_optimizador
+ *
+ * Recorre un bloque de enunciados, primero optimiza los bloques internos
+ * y despues los ciclos, para que los ciclos internos se resuelvan antes que los externos.
+ * Mientras avanza lleva las variables que en ese punto tienen un valor entero.
+ *
+ * @param opt Estado del optimizador
+ * @param bloque Bloque de enunciados a optimizar
+ * @param enteros Variables que tienen un valor entero al inicio del bloque
+ */
+void optimizarBloque(Optimizador* opt, Programa* bloque, Conjunto* enteros)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        Modificaciones mod = {0};
+        Conjunto interno = {0};
+
+        switch(e->tipo)
+        {
+            case ENUNC_SI:
+                copiarConjunto(&interno,enteros);
+                optimizarBloque(opt,e->si.entonces,&interno);
+                liberarConjunto(&interno);
+
+                copiarConjunto(&interno,enteros);
+                optimizarBloque(opt,e->si.si_no,&interno);
+                liberarConjunto(&interno);
+
+                recolectarModificaciones(e->si.entonces,&mod,1);
+                recolectarModificaciones(e->si.si_no,&mod,1);
+                break;
+
+            case ENUNC_MIENTRAS:
+                recolectarModificaciones(e->mientras.cuerpo,&mod,1);
+                copiarConjunto(&interno,enteros);
+                for(int i = 0; i < mod.escalares.cantidad; i++)
+                    quitarConjunto(&interno,mod.escalares.nombres[i]);
+
+                optimizarBloque(opt,e->mientras.cuerpo,&interno);
+                liberarConjunto(&interno);
+
+                moverInvariantes(opt,e);
+                contarCiclo(opt,e,enteros);
+                reservarCapacidad(e);
+                break;
+
+            case ENUNC_ASIGNACION:
+                if(e->asignacion.variable.tipo != VAL_VARIABLE)
+                    break;
+
+                if(e->asignacion.expresion->tipo == EXPR_VALOR && e->asignacion.expresion->valor.tipo == VAL_NUMERO
+                    && valorEntero(e->asignacion.expresion->valor,NULL))
+                    agregarConjunto(enteros,e->asignacion.variable.nombre);
+                else
+                    quitarConjunto(enteros,e->asignacion.variable.nombre);
+                break;
+
+            case ENUNC_LEER:
+                quitarConjunto(enteros,e->leer.variable);
+                break;
+
+            case ENUNC_DECLARACION:
+                for(int i = 0; i < e->declaracion.cantidad; i++)
+                    quitarConjunto(enteros,e->declaracion.variables[i]);
+                break;
+
+            default:
+                break;
+        }
+
+        for(int i = 0; i < mod.escalares.cantidad; i++)
+            quitarConjunto(enteros,mod.escalares.nombres[i]);
+
+        //Al terminar un ciclo contado la variable queda con el valor entero del contador
+        if(e->tipo == ENUNC_MIENTRAS && e->mientras.contador)
+            agregarConjunto(enteros,e->mientras.inductor);
+
+        liberarModificaciones(&mod);
+    }
+}
+
+/**
+ * @brief Contar ciclo
+ * @ingroup funciones_optimizador
+ *
+ * Reconoce el ciclo de la forma randy i < n ... i = i + 1 orton, donde i empieza con
+ * un valor entero(o siempre es entera) y solo se modifica en el ultimo enunciado. Ese ciclo se escribe como un for
+ * con un contador entero, todas las lecturas de i dentro del ciclo usan el contador
+ * y al terminar se le asigna el contador a i.
+ *
+ * @param opt Estado del optimizador
+ * @param ciclo Enunciado del tipo mientras
+ * @param enteros Variables que tienen un valor entero antes del ciclo
+ */
+void contarCiclo(Optimizador* opt, Enunciado* ciclo, Conjunto* enteros)
+{
+    Valor izquierda = ciclo->mientras.comp.izquierda;
+    Programa* cuerpo = ciclo->mientras.cuerpo;
+
+    if(izquierda.tipo != VAL_VARIABLE)
+        return;
+
+    if(!contieneConjunto(enteros,izquierda.nombre) && !contieneConjunto(&opt->enteros,izquierda.nombre))
+        return;
+
+    Enunciado* ultimo = cuerpo->ultimo_enunciado;
+    if(!ultimo || ultimo->tipo != ENUNC_ASIGNACION || ultimo->asignacion.variable.tipo != VAL_VARIABLE
+        || strcmp(ultimo->asignacion.variable.nombre,izquierda.nombre))
+        return;
+
+    int paso = pasoAsignacion(ultimo->asignacion.expresion,izquierda.nombre);
+    OPRelacional op = ciclo->mientras.comp.operador;
+
+    if(!((paso == 1 && (op == OP_MENOR || op == OP_MENOR_IGUAL)) || (paso == -1 && (op == OP_MAYOR || op == OP_MAYOR_IGUAL))))
+        return;
+
+    Modificaciones mod = {0};
+    recolectarModificaciones(cuerpo,&mod,1);
+    int asignaciones = contarAsignaciones(cuerpo,izquierda.nombre);
+    int valido = asignaciones == 1 && !contieneConjunto(&mod.listas,izquierda.nombre);
+    liberarModificaciones(&mod);
+
+    if(!valido)
+        return;
+
+    //Se quita el incremento, ahora lo hace el for
+    Enunciado* anterior = NULL;
+    for(Enunciado* e = cuerpo->lista_enunciados; e != ultimo; e = e->siguiente)
+        anterior = e;
+
+    if(anterior)
+        anterior->siguiente = NULL;
+    else
+        cuerpo->lista_enunciados = NULL;
+    cuerpo->ultimo_enunciado = anterior;
+
+    Programa temporal = {0};
+    temporal.lista_enunciados = ultimo;
+    eliminarPrograma(&temporal);
+
+    char nombre[32];
+    snprintf(nombre,sizeof(nombre),"_wwe_c%d",opt->temporales++);
+
+    ciclo->mientras.contador = strdup(nombre);
+    ciclo->mientras.inductor = strdup(izquierda.nombre);
+    ciclo->mientras.paso = paso;
+
+    renombrarValor(&ciclo->mientras.comp.izquierda,ciclo->mientras.inductor,nombre);
+    renombrarValor(&ciclo->mientras.comp.derecha,ciclo->mientras.inductor,nombre);
+    renombrarVariable(cuerpo,ciclo->mientras.inductor,nombre);
+}
+
+/**
+ * @brief Paso de una asignacion
+ * @ingroup funciones_analisis
+ *
+ * Revisa si la expresion es nombre + 1, 1 + nombre o nombre - 1.
+ *
+ * @param expr Expresion asignada
+ * @param nombre Variable del ciclo
+ *
+ * @return int 1 si incrementa, -1 si decrementa y 0 si no es ninguno
+ */
+int pasoAsignacion(Expresion* expr, char* nombre)
+{
+    if(expr->tipo != EXPR_BINARIA || expr->binaria.izquierda->tipo != EXPR_VALOR || expr->binaria.derecha->tipo != EXPR_VALOR)
+        return 0;
+
+    Valor izquierda = expr->binaria.izquierda->valor;
+    Valor derecha = expr->binaria.derecha->valor;
+    char* op = expr->binaria.oparitmetico;
+
+    if(izquierda.tipo == VAL_VARIABLE && !strcmp(izquierda.nombre,nombre) && derecha.tipo == VAL_NUMERO && derecha.numero == 1)
+    {
+        if(!strcmp(op,"+"))
+            return 1;
+        if(!strcmp(op,"-"))
+            return -1;
+    }
+
+    if(derecha.tipo == VAL_VARIABLE && !strcmp(derecha.nombre,nombre) && izquierda.tipo == VAL_NUMERO && izquierda.numero == 1
+        && !strcmp(op,"+"))
+        return 1;
+
+    return 0;
+}
+
+/**
+ * @brief Contar asignaciones
+ * @ingroup funciones_analisis
+ *
+ * Cuenta los enunciados de un bloque y sus bloques internos que cambian el valor
+ * de una variable, incluyendo leerla, declararla de nuevo o usarla como contador.
+ *
+ * @param bloque Bloque a revisar
+ * @param nombre Variable a buscar
+ *
+ * @return int Cantidad de enunciados que modifican la variable
+ */
+int contarAsignaciones(Programa* bloque, char* nombre)
+{
+    int cantidad = 0;
+
+    if(!bloque)
+        return 0;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_DECLARACION:
+                for(int i = 0; i < e->declaracion.cantidad; i++)
+                    cantidad += !strcmp(e->declaracion.variables[i],nombre);
+                break;
+            case ENUNC_ASIGNACION:
+                cantidad += e->asignacion.variable.tipo == VAL_VARIABLE && !strcmp(e->asignacion.variable.nombre,nombre);
+                break;
+            case ENUNC_LEER:
+                cantidad += !strcmp(e->leer.variable,nombre);
+                break;
+            case ENUNC_SI:
+                cantidad += contarAsignaciones(e->si.entonces,nombre);
+                cantidad += contarAsignaciones(e->si.si_no,nombre);
+                break;
+            case ENUNC_MIENTRAS:
+                cantidad += e->mientras.inductor && !strcmp(e->mientras.inductor,nombre);
+                cantidad += contarAsignaciones(e->mientras.previo,nombre);
+                cantidad += contarAsignaciones(e->mientras.cuerpo,nombre);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return cantidad;
+}
+
+/**
+ * @brief Reservar capacidad
+ * @ingroup funciones_optimizador
+ *
+ * Si un ciclo contado agrega a una lista en cada vuelta, ya se sabe antes del ciclo
+ * cuantos elementos va a tener, asi que se reserva todo de una vez en el previo
+ * en vez de ir duplicando el arreglo.
+ *
+ * @param ciclo Enunciado del tipo mientras ya contado
+ */
+void reservarCapacidad(Enunciado* ciclo)
+{
+    Mientras* m = &ciclo->mientras;
+
+    if(!m->contador)
+        return;
+
+    //El limite se evalua antes del ciclo aunque no se ejecute, solo valores que no pueden fallar
+    Valor limite = m->comp.derecha;
+    if(limite.tipo != VAL_VARIABLE && limite.tipo != VAL_NUMERO && limite.tipo != VAL_LISTA_S)
+        return;
+
+    Modificaciones mod = {0};
+    recolectarModificaciones(m->cuerpo,&mod,1);
+    int invariante = valorInvariante(limite,&mod);
+    liberarModificaciones(&mod);
+
+    if(!invariante)
+        return;
+
+    Valor inicio = {0};
+    inicio.tipo = VAL_VARIABLE;
+    inicio.nombre = m->inductor;
+
+    Conjunto reservadas = {0};
+    for(Enunciado* e = m->cuerpo->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        char* lista;
+        if(e->tipo == ENUNC_ASIGNACION_LISTA)
+            lista = e->asignacion.variable.nombre;
+        else if(e->tipo == ENUNC_LEER_LISTA)
+            lista = e->leer.variable;
+        else
+            continue;
+
+        int porVuelta = contarAgregados(m->cuerpo,lista);
+        if(!porVuelta || contieneConjunto(&reservadas,lista))
+            continue;
+        agregarConjunto(&reservadas,lista);
+
+        if(!m->previo)
+            m->previo = (Programa*)calloc(1,sizeof(Programa));
+
+        Enunciado* reservar = (Enunciado*)calloc(1,sizeof(Enunciado));
+        reservar->tipo = ENUNC_RESERVAR_LISTA;
+        reservar->reservar.lista = strdup(lista);
+        reservar->reservar.desde = copiarValor(m->paso > 0 ? inicio : limite);
+        reservar->reservar.hasta = copiarValor(m->paso > 0 ? limite : inicio);
+        reservar->reservar.porVuelta = porVuelta;
+        pushEnunciado(m->previo,reservar);
+    }
+    liberarConjunto(&reservadas);
+}
+
+/**
+ * @brief Renombrar valor
+ * @ingroup funciones_optimizador
+ *
+ * Cambia las lecturas de una variable por otra que ya es entera.
+ *
+ * @param val Valor a revisar
+ * @param viejo Nombre de la variable original
+ * @param nuevo Nombre de la variable entera
+ */
+void renombrarValor(Valor* val, char* viejo, char* nuevo)
+{
+    if(val->tipo == VAL_VARIABLE && !strcmp(val->nombre,viejo))
+    {
+        free(val->nombre);
+        val->nombre = strdup(nuevo);
+        val->entero = 1;
+    }
+    else if(val->tipo == VAL_LISTA_INDEX_VAR && !strcmp(val->var,viejo))
+    {
+        free(val->var);
+        val->var = strdup(nuevo);
+        val->entero = 1;
+    }
+}
+
+/**
+ * @brief Renombrar expresion
+ * @ingroup funciones_optimizador
+ *
+ * @param expr Expresion a revisar
+ * @param viejo Nombre de la variable original
+ * @param nuevo Nombre de la variable entera
+ */
+void renombrarExpresion(Expresion* expr, char* viejo, char* nuevo)
+{
+    if(!expr)
+        return;
+
+    if(expr->tipo == EXPR_VALOR)
+        renombrarValor(&expr->valor,viejo,nuevo);
+    else
+    {
+        renombrarExpresion(expr->binaria.izquierda,viejo,nuevo);
+        renombrarExpresion(expr->binaria.derecha,viejo,nuevo);
+    }
+}
+
+/**
+ * @brief Renombrar variable
+ * @ingroup funciones_optimizador
+ *
+ * Cambia todas las lecturas de una variable dentro de un bloque y sus bloques internos.
+ *
+ * @param bloque Bloque a revisar
+ * @param viejo Nombre de la variable original
+ * @param nuevo Nombre de la variable entera
+ */
+void renombrarVariable(Programa* bloque, char* viejo, char* nuevo)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_ASIGNACION:
+            case ENUNC_ASIGNACION_LISTA:
+                if(e->asignacion.variable.tipo == VAL_LISTA_INDEX_VAR)
+                    renombrarValor(&e->asignacion.variable,viejo,nuevo);
+                renombrarExpresion(e->asignacion.expresion,viejo,nuevo);
+                break;
+            case ENUNC_ANUNCIAR:
+                if(!e->anunciar.esCadena)
+                    renombrarExpresion(e->anunciar.expresion,viejo,nuevo);
+                break;
+            case ENUNC_SI:
+                renombrarValor(&e->si.comp.izquierda,viejo,nuevo);
+                renombrarValor(&e->si.comp.derecha,viejo,nuevo);
+                renombrarVariable(e->si.entonces,viejo,nuevo);
+                renombrarVariable(e->si.si_no,viejo,nuevo);
+                break;
+            case ENUNC_MIENTRAS:
+                renombrarVariable(e->mientras.previo,viejo,nuevo);
+                renombrarValor(&e->mientras.comp.izquierda,viejo,nuevo);
+                renombrarValor(&e->mientras.comp.derecha,viejo,nuevo);
+                renombrarVariable(e->mientras.cuerpo,viejo,nuevo);
+                break;
+            case ENUNC_ORDENAR:
+                if(e->ordenar.parcial)
+                    renombrarValor(&e->ordenar.hasta,viejo,nuevo);
+                break;
+            case ENUNC_OPERAR_LISTA:
+                renombrarExpresion(e->operar.expresion,viejo,nuevo);
+                break;
+            case ENUNC_RESERVAR_LISTA:
+                renombrarValor(&e->reservar.desde,viejo,nuevo);
+                renombrarValor(&e->reservar.hasta,viejo,nuevo);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Mover invariantes
+ * @ingroup funciones_optimizador
+ *
+ * Saca del ciclo las expresiones que no cambian entre iteraciones y las lecturas
+ * del tamaño o del primer elemento de listas a las que no se les hace push dentro del ciclo.
+ * Los valores se calculan una sola vez en variables temporales antes del while.
+ *
+ * @param opt Estado del optimizador
+ * @param ciclo Enunciado del tipo mientras
+ */
+void moverInvariantes(Optimizador* opt, Enunciado* ciclo)
+{
+    Modificaciones mod = {0};
+
+    recolectarModificaciones(ciclo->mientras.cuerpo,&mod,0);
+    moverPrevios(ciclo,ciclo->mientras.cuerpo,&mod);
+    liberarModificaciones(&mod);
+
+    //Los temporales que se quedaron en ciclos internos se asignan dentro de este ciclo
+    recolectarModificaciones(ciclo->mientras.cuerpo,&mod,1);
+
+    subirValor(opt,ciclo,&ciclo->mientras.comp.izquierda,&mod,1);
+    subirValor(opt,ciclo,&ciclo->mientras.comp.derecha,&mod,1);
+    subirExpresiones(opt,ciclo,ciclo->mientras.cuerpo,&mod);
+
+    liberarModificaciones(&mod);
+}
+
+/**
+ * @brief Mover previos
+ *
+ * Los ciclos internos ya tienen sus invariantes antes del while, si esas asignaciones
+ * tampoco cambian en el ciclo externo se mueven completas al previo del ciclo externo.
+ *
+ * @param ciclo Ciclo externo
+ * @param bloque Bloque donde se buscan los ciclos internos
+ * @param mod Modificaciones del ciclo externo
+ */
+void moverPrevios(Enunciado* ciclo, Programa* bloque, Modificaciones* mod)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        if(e->tipo == ENUNC_SI)
+        {
+            moverPrevios(ciclo,e->si.entonces,mod);
+            moverPrevios(ciclo,e->si.si_no,mod);
+        }
+
+        if(e->tipo != ENUNC_MIENTRAS || !e->mientras.previo)
+            continue;
+
+        Programa* previo = e->mientras.previo;
+        Enunciado* anterior = NULL;
+        Enunciado* actual = previo->lista_enunciados;
+
+        //El previo empieza con pares de declaracion y asignacion del temporal, despues van las reservas
+        while(actual && actual->tipo == ENUNC_DECLARACION && actual->siguiente)
+        {
+            Enunciado* declaracion = actual;
+            Enunciado* asignacion = actual->siguiente;
+            Enunciado* siguiente = asignacion->siguiente;
+
+            if(expresionSegura(asignacion->asignacion.expresion) && expresionInvariante(asignacion->asignacion.expresion,mod))
+            {
+                if(anterior)
+                    anterior->siguiente = siguiente;
+                else
+                    previo->lista_enunciados = siguiente;
+
+                if(previo->ultimo_enunciado == asignacion)
+                    previo->ultimo_enunciado = anterior;
+
+                if(!ciclo->mientras.previo)
+                    ciclo->mientras.previo = (Programa*)calloc(1,sizeof(Programa));
+
+                asignacion->siguiente = NULL;
+                pushEnunciado(ciclo->mientras.previo,declaracion);
+                pushEnunciado(ciclo->mientras.previo,asignacion);
+            }
+            else
+                anterior = asignacion;
+
+            actual = siguiente;
+        }
+    }
+}
+
+/**
+ * @brief Subir expresiones
+ *
+ * Revisa cada lugar donde hay una expresion o comparacion dentro del cuerpo del ciclo
+ * y saca lo que sea invariante.
+ *
+ * @param opt Estado del optimizador
+ * @param ciclo Ciclo que recibe los invariantes
+ * @param bloque Bloque a revisar
+ * @param mod Modificaciones del ciclo
+ */
+void subirExpresiones(Optimizador* opt, Enunciado* ciclo, Programa* bloque, Modificaciones* mod)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_ASIGNACION:
+            case ENUNC_ASIGNACION_LISTA:
+                subirExpresion(opt,ciclo,&e->asignacion.expresion,mod);
+                break;
+
+            case ENUNC_ANUNCIAR:
+                if(!e->anunciar.esCadena)
+                    subirExpresion(opt,ciclo,&e->anunciar.expresion,mod);
+                break;
+
+            case ENUNC_OPERAR_LISTA:
+                subirExpresion(opt,ciclo,&e->operar.expresion,mod);
+                break;
+
+            case ENUNC_SI:
+                subirValor(opt,ciclo,&e->si.comp.izquierda,mod,0);
+                subirValor(opt,ciclo,&e->si.comp.derecha,mod,0);
+                subirExpresiones(opt,ciclo,e->si.entonces,mod);
+                subirExpresiones(opt,ciclo,e->si.si_no,mod);
+                break;
+
+            case ENUNC_MIENTRAS:
+                subirExpresiones(opt,ciclo,e->mientras.previo,mod);
+                subirValor(opt,ciclo,&e->mientras.comp.izquierda,mod,0);
+                subirValor(opt,ciclo,&e->mientras.comp.derecha,mod,0);
+                subirExpresiones(opt,ciclo,e->mientras.cuerpo,mod);
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Subir expresion
+ *
+ * Si toda la expresion es invariante y segura se calcula antes del ciclo,
+ * si no, solo se sacan los valores de las listas que sean invariantes.
+ *
+ * @param opt Estado del optimizador
+ * @param ciclo Ciclo que recibe los invariantes
+ * @param expr Apuntador a la expresion, se reemplaza si se mueve completa
+ * @param mod Modificaciones del ciclo
+ */
+void subirExpresion(Optimizador* opt, Enunciado* ciclo, Expresion** expr, Modificaciones* mod)
+{
+    if(!*expr)
+        return;
+
+    if((*expr)->tipo == EXPR_BINARIA && expresionSegura(*expr) && expresionInvariante(*expr,mod))
+    {
+        Expresion* temporal = (Expresion*)calloc(1,sizeof(Expresion));
+        temporal->tipo = EXPR_VALOR;
+        temporal->valor.tipo = VAL_VARIABLE;
+        temporal->valor.nombre = nuevoTemporal(opt,ciclo,*expr);
+        *expr = temporal;
+        return;
+    }
+
+    subirHojas(opt,ciclo,*expr,mod);
+}
+
+/**
+ * @brief Subir hojas
+ *
+ * Saca solo los valores de la expresion. Las subexpresiones no se pueden mover porque
+ * la expresion se escribe sin parentesis y el arbol no respeta la precedencia de C.
+ *
+ * @param opt Estado del optimizador
+ * @param ciclo Ciclo que recibe los invariantes
+ * @param expr Expresion a revisar
+ * @param mod Modificaciones del ciclo
+ */
+void subirHojas(Optimizador* opt, Enunciado* ciclo, Expresion* expr, Modificaciones* mod)
+{
+    if(!expr)
+        return;
+
+    if(expr->tipo == EXPR_VALOR)
+        subirValor(opt,ciclo,&expr->valor,mod,0);
+    else
+    {
+        subirHojas(opt,ciclo,expr->binaria.izquierda,mod);
+        subirHojas(opt,ciclo,expr->binaria.derecha,mod);
+    }
+}
+
+/**
+ * @brief Subir valor
+ *
+ * Saca del ciclo las lecturas de una lista que no cambia. El tamaño y la suma siempre
+ * se pueden leer, el primer y el ultimo elemento, el minimo, el maximo, el producto
+ * punto y los indices solo se sacan de la condicion del ciclo porque esa siempre se evalua
+ * al menos una vez y pueden terminar el programa si la lista esta vacia.
+ *
+ * @param opt Estado del optimizador
+ * @param ciclo Ciclo que recibe los invariantes
+ * @param val Valor a revisar, se reemplaza por el temporal si se mueve
+ * @param mod Modificaciones del ciclo
+ * @param condicion Booleano para saber si el valor es de la condicion del ciclo
+ */
+void subirValor(Optimizador* opt, Enunciado* ciclo, Valor* val, Modificaciones* mod, int condicion)
+{
+    switch(val->tipo)
+    {
+        case VAL_LISTA_S:
+        case VAL_LISTA_T:
+            break;
+        case VAL_LISTA_F:
+        case VAL_LISTA_L:
+        case VAL_LISTA_N:
+        case VAL_LISTA_X:
+        case VAL_LISTA_P:
+        case VAL_LISTA_INDEX:
+        case VAL_LISTA_INDEX_VAR:
+            if(!condicion)
+                return;
+            break;
+        default:
+            return;
+    }
+
+    if(!valorInvariante(*val,mod))
+        return;
+
+    Expresion* expr = (Expresion*)calloc(1,sizeof(Expresion));
+    expr->tipo = EXPR_VALOR;
+    expr->valor = *val;
+
+    Valor temporal = {0};
+    temporal.tipo = VAL_VARIABLE;
+    temporal.nombre = nuevoTemporal(opt,ciclo,expr);
+    *val = temporal;
+}
+
+/**
+ * @brief Nuevo temporal
+ *
+ * Crea una variable temporal en el previo del ciclo y le asigna la expresion.
+ *
+ * @param opt Estado del optimizador
+ * @param ciclo Ciclo que recibe el temporal
+ * @param expr Expresion que se asigna al temporal
+ *
+ * @return char* Nombre del temporal para usarlo dentro del ciclo
+ */
+char* nuevoTemporal(Optimizador* opt, Enunciado* ciclo, Expresion* expr)
+{
+    char nombre[32];
+    snprintf(nombre,sizeof(nombre),"_wwe_inv%d",opt->temporales++);
+
+    if(!ciclo->mientras.previo)
+        ciclo->mientras.previo = (Programa*)calloc(1,sizeof(Programa));
+
+    Enunciado* declaracion = (Enunciado*)calloc(1,sizeof(Enunciado));
+    declaracion->tipo = ENUNC_DECLARACION;
+    declaracion->linea = ciclo->linea;
+    declaracion->columna = ciclo->columna;
+    declaracion->declaracion.cantidad = 1;
+    declaracion->declaracion.variables = (char**)malloc(sizeof(char*));
+    declaracion->declaracion.variables[0] = strdup(nombre);
+    pushEnunciado(ciclo->mientras.previo,declaracion);
+
+    Enunciado* asignacion = (Enunciado*)calloc(1,sizeof(Enunciado));
+    asignacion->tipo = ENUNC_ASIGNACION;
+    asignacion->linea = ciclo->linea;
+    asignacion->columna = ciclo->columna;
+    asignacion->asignacion.variable.tipo = VAL_VARIABLE;
+    asignacion->asignacion.variable.nombre = strdup(nombre);
+    asignacion->asignacion.expresion = expr;
+    pushEnunciado(ciclo->mientras.previo,asignacion);
+
+    return strdup(nombre);
+}
+
+/**
+ * @brief Contar agregados
+ * @ingroup funciones_analisis
+ *
+ * @param cuerpo Cuerpo del ciclo
+ * @param lista Nombre de la lista
+ *
+ * @return int Cuantas veces se agrega a la lista en cada vuelta sin condiciones,
+ * 0 si la lista se vuelve a declarar en el cuerpo
+ */
+int contarAgregados(Programa* cuerpo, char* lista)
+{
+    int agregados = 0;
+
+    for(Enunciado* e = cuerpo->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        if(e->tipo == ENUNC_DECLARACION_LISTA)
+            for(int i = 0; i < e->declaracion.cantidad; i++)
+                if(!strcmp(e->declaracion.variables[i],lista))
+                    return 0;
+
+        if(e->tipo == ENUNC_ASIGNACION_LISTA && !strcmp(e->asignacion.variable.nombre,lista))
+            agregados++;
+        if(e->tipo == ENUNC_LEER_LISTA && !strcmp(e->leer.variable,lista))
+            agregados++;
+    }
+
+    return agregados;
+}
+
+/**
+ * @brief Inferir enteros
+ * @ingroup funciones_optimizador
+ *
+ * Empieza suponiendo que todas las variables declaradas son enteras y quita las que
+ * reciben un valor que puede tener decimales o que puede crecer sin limite, hasta que ya no cambie el conjunto.
+ * Solo quedan contadores, indices y resultados de modulo, los acumuladores y las recurrencias
+ * como la de fibonacci se quedan como Numero para que no se desborden.
+ * Las variables que se leen con promo siempre son flotantes.
+ *
+ * @param programa Lista de enunciados completa
+ * @param enteros Conjunto vacio donde quedan las variables enteras
+ */
+void inferirEnteros(Programa* programa, Conjunto* enteros)
+{
+    recolectarDeclaradas(programa,enteros);
+
+    while(depurarEnteros(programa,enteros));
+}
+
+/**
+ * @brief Recolectar declaradas
+ * @ingroup funciones_analisis
+ *
+ * @param bloque Bloque a revisar
+ * @param declaradas Conjunto donde se guardan las variables declaradas con nxt
+ */
+void recolectarDeclaradas(Programa* bloque, Conjunto* declaradas)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_DECLARACION:
+                for(int i = 0; i < e->declaracion.cantidad; i++)
+                    agregarConjunto(declaradas,e->declaracion.variables[i]);
+                break;
+            case ENUNC_SI:
+                recolectarDeclaradas(e->si.entonces,declaradas);
+                recolectarDeclaradas(e->si.si_no,declaradas);
+                break;
+            case ENUNC_MIENTRAS:
+                recolectarDeclaradas(e->mientras.previo,declaradas);
+                recolectarDeclaradas(e->mientras.cuerpo,declaradas);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Depurar enteros
+ * @ingroup funciones_analisis
+ *
+ * Quita del conjunto las variables que reciben un valor que no es entero o que no esta acotado.
+ * El contador de un ciclo contado siempre es entero, asi que la variable original no se quita.
+ *
+ * @param bloque Bloque a revisar
+ * @param enteros Conjunto de variables enteras
+ *
+ * @return int Si se quito alguna variable
+ */
+int depurarEnteros(Programa* bloque, Conjunto* enteros)
+{
+    int cambio = 0;
+
+    if(!bloque)
+        return 0;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_ASIGNACION:
+                if(e->asignacion.variable.tipo == VAL_VARIABLE && contieneConjunto(enteros,e->asignacion.variable.nombre)
+                    && (!expresionEntera(e->asignacion.expresion,enteros) || !expresionAcotada(e->asignacion.expresion,enteros)))
+                {
+                    quitarConjunto(enteros,e->asignacion.variable.nombre);
+                    cambio = 1;
+                }
+                break;
+            case ENUNC_LEER:
+                if(contieneConjunto(enteros,e->leer.variable))
+                {
+                    quitarConjunto(enteros,e->leer.variable);
+                    cambio = 1;
+                }
+                break;
+            case ENUNC_SI:
+                cambio |= depurarEnteros(e->si.entonces,enteros);
+                cambio |= depurarEnteros(e->si.si_no,enteros);
+                break;
+            case ENUNC_MIENTRAS:
+                cambio |= depurarEnteros(e->mientras.previo,enteros);
+                cambio |= depurarEnteros(e->mientras.cuerpo,enteros);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return cambio;
+}
+
+/**
+ * @brief Valor entero
+ * @ingroup funciones_analisis
+ *
+ * @param val Valor a revisar
+ * @param enteros Conjunto de variables enteras, si es NULL solo se revisa lo marcado en el valor
+ *
+ * @return int Si el valor siempre es entero
+ */
+int valorEntero(Valor val, Conjunto* enteros)
+{
+    switch(val.tipo)
+    {
+        case VAL_NUMERO:
+            //Fuera de este rango el flotante ya no representa todos los enteros
+            if(val.numero <= -9007199254740992.0 || val.numero >= 9007199254740992.0)
+                return 0;
+            return val.numero == (long)val.numero;
+        case VAL_VARIABLE:
+            return val.entero || (enteros && contieneConjunto(enteros,val.nombre));
+        case VAL_LISTA_S:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Expresion entera
+ * @ingroup funciones_analisis
+ *
+ * El modulo siempre da un entero porque sus operandos se convierten a entero,
+ * la division siempre da un flotante y las demas operaciones son enteras si sus dos lados lo son.
+ *
+ * @param expr Expresion a revisar
+ * @param enteros Conjunto de variables enteras, si es NULL solo se revisa lo marcado en los valores
+ *
+ * @return int Si la expresion siempre es entera
+ */
+int expresionEntera(Expresion* expr, Conjunto* enteros)
+{
+    if(!expr)
+        return 0;
+
+    if(expr->tipo == EXPR_VALOR)
+        return valorEntero(expr->valor,enteros);
+
+    if(!strcmp(expr->binaria.oparitmetico,"%"))
+        return 1;
+
+    if(!strcmp(expr->binaria.oparitmetico,"/"))
+        return 0;
+
+    return expresionEntera(expr->binaria.izquierda,enteros) && expresionEntera(expr->binaria.derecha,enteros);
+}
+
+/**
+ * @brief Expresion acotada
+ * @ingroup funciones_analisis
+ *
+ * Una expresion esta acotada si no puede crecer mas de una constante por cada vez que se ejecuta,
+ * asi un contador como i = i + 1 no se desborda pero un acumulador como s = s + x si podria.
+ * Los valores simples y el modulo estan acotados, la suma y la resta solo si uno de sus lados
+ * es un numero pequeño y el otro esta acotado.
+ *
+ * @param expr Expresion a revisar
+ * @param enteros Conjunto de variables enteras
+ *
+ * @return int Si la expresion esta acotada
+ */
+int expresionAcotada(Expresion* expr, Conjunto* enteros)
+{
+    if(!expr)
+        return 0;
+
+    if(expr->tipo == EXPR_VALOR)
+        return valorEntero(expr->valor,enteros);
+
+    if(!strcmp(expr->binaria.oparitmetico,"%"))
+        return 1;
+
+    if(strcmp(expr->binaria.oparitmetico,"+") && strcmp(expr->binaria.oparitmetico,"-"))
+        return 0;
+
+    Expresion* izq = expr->binaria.izquierda;
+    Expresion* der = expr->binaria.derecha;
+
+    if(constantePequena(der))
+        return expresionAcotada(izq,enteros);
+    if(constantePequena(izq))
+        return expresionAcotada(der,enteros);
+
+    return 0;
+}
+
+/**
+ * @brief Constante pequeña
+ * @ingroup funciones_analisis
+ *
+ * @param expr Expresion a revisar
+ *
+ * @return int Si la expresion es un numero entero de valor absoluto menor a 2^20
+ */
+int constantePequena(Expresion* expr)
+{
+    if(!expr || expr->tipo != EXPR_VALOR || expr->valor.tipo != VAL_NUMERO)
+        return 0;
+
+    return expr->valor.numero > -1048576.0 && expr->valor.numero < 1048576.0 && valorEntero(expr->valor,NULL);
+}
+
+/**
+ * @brief Marcar enteros
+ * @ingroup funciones_optimizador
+ *
+ * Marca las declaraciones y las lecturas de las variables enteras para que
+ * el traductor las escriba como int64_t y no use conversiones.
+ *
+ * @param bloque Bloque a marcar
+ * @param enteros Conjunto de variables enteras
+ */
+void marcarEnteros(Programa* bloque, Conjunto* enteros)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_DECLARACION:
+                free(e->declaracion.enteros);
+                e->declaracion.enteros = (int*)calloc(e->declaracion.cantidad,sizeof(int));
+                for(int i = 0; i < e->declaracion.cantidad; i++)
+                    e->declaracion.enteros[i] = contieneConjunto(enteros,e->declaracion.variables[i]);
+                break;
+            case ENUNC_ASIGNACION:
+            case ENUNC_ASIGNACION_LISTA:
+                marcarValor(&e->asignacion.variable,enteros);
+                marcarExpresion(e->asignacion.expresion,enteros);
+                break;
+            case ENUNC_ANUNCIAR:
+                if(!e->anunciar.esCadena)
+                    marcarExpresion(e->anunciar.expresion,enteros);
+                break;
+            case ENUNC_OPERAR_LISTA:
+                marcarExpresion(e->operar.expresion,enteros);
+                break;
+            case ENUNC_SI:
+                marcarValor(&e->si.comp.izquierda,enteros);
+                marcarValor(&e->si.comp.derecha,enteros);
+                marcarEnteros(e->si.entonces,enteros);
+                marcarEnteros(e->si.si_no,enteros);
+                break;
+            case ENUNC_MIENTRAS:
+                marcarEnteros(e->mientras.previo,enteros);
+                marcarValor(&e->mientras.comp.izquierda,enteros);
+                marcarValor(&e->mientras.comp.derecha,enteros);
+                marcarEnteros(e->mientras.cuerpo,enteros);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Marcar valor
+ *
+ * @param val Valor a marcar
+ * @param enteros Conjunto de variables enteras
+ */
+void marcarValor(Valor* val, Conjunto* enteros)
+{
+    if(val->tipo == VAL_VARIABLE && contieneConjunto(enteros,val->nombre))
+        val->entero = 1;
+    else if(val->tipo == VAL_LISTA_INDEX_VAR && contieneConjunto(enteros,val->var))
+        val->entero = 1;
+}
+
+/**
+ * @brief Marcar expresion
+ *
+ * @param expr Expresion a marcar
+ * @param enteros Conjunto de variables enteras
+ */
+void marcarExpresion(Expresion* expr, Conjunto* enteros)
+{
+    if(!expr)
+        return;
+
+    if(expr->tipo == EXPR_VALOR)
+        marcarValor(&expr->valor,enteros);
+    else
+    {
+        marcarExpresion(expr->binaria.izquierda,enteros);
+        marcarExpresion(expr->binaria.derecha,enteros);
+    }
+}
+
+/**
+ * @brief Recolectar modificaciones
+ * @ingroup funciones_analisis
+ *
+ * Revisa un bloque y todos sus bloques internos y guarda que variables y listas
+ * pueden cambiar dentro de el. Las declaraciones cuentan como modificacion porque
+ * la variable no existe fuera del bloque.
+ *
+ * @param bloque Bloque a revisar
+ * @param mod Donde se guardan las modificaciones
+ * @param conPrevio Booleano para revisar tambien los previos de los ciclos internos
+ */
+void recolectarModificaciones(Programa* bloque, Modificaciones* mod, int conPrevio)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_DECLARACION:
+                for(int i = 0; i < e->declaracion.cantidad; i++)
+                    agregarConjunto(&mod->escalares,e->declaracion.variables[i]);
+                break;
+            case ENUNC_DECLARACION_LISTA:
+                for(int i = 0; i < e->declaracion.cantidad; i++)
+                    agregarConjunto(&mod->listas,e->declaracion.variables[i]);
+                break;
+            case ENUNC_ASIGNACION:
+                if(e->asignacion.variable.tipo == VAL_VARIABLE)
+                    agregarConjunto(&mod->escalares,e->asignacion.variable.nombre);
+                else
+                    agregarConjunto(&mod->escritas,e->asignacion.variable.nombre);
+                break;
+            case ENUNC_ASIGNACION_LISTA:
+                agregarConjunto(&mod->listas,e->asignacion.variable.nombre);
+                break;
+            case ENUNC_LEER:
+                agregarConjunto(&mod->escalares,e->leer.variable);
+                break;
+            case ENUNC_LEER_LISTA:
+            case ENUNC_LEER_TODO:
+                agregarConjunto(&mod->listas,e->leer.variable);
+                break;
+            case ENUNC_ORDENAR:
+                agregarConjunto(&mod->escritas,e->ordenar.lista);
+                break;
+            case ENUNC_CARGAR_LISTA:
+                agregarConjunto(&mod->listas,e->archivo.lista);
+                agregarConjunto(&mod->escritas,e->archivo.lista);
+                break;
+            case ENUNC_OPERAR_LISTA:
+                agregarConjunto(&mod->escritas,e->operar.lista);
+                break;
+            case ENUNC_SI:
+                recolectarModificaciones(e->si.entonces,mod,conPrevio);
+                recolectarModificaciones(e->si.si_no,mod,conPrevio);
+                break;
+            case ENUNC_MIENTRAS:
+                //El for de un ciclo contado asigna el contador y la variable original
+                agregarConjunto(&mod->escalares,e->mientras.contador);
+                agregarConjunto(&mod->escalares,e->mientras.inductor);
+                if(conPrevio)
+                    recolectarModificaciones(e->mientras.previo,mod,conPrevio);
+                recolectarModificaciones(e->mientras.cuerpo,mod,conPrevio);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Valor invariante
+ * @ingroup funciones_analisis
+ *
+ * Revisa si un valor da lo mismo en todas las iteraciones del ciclo.
+ *
+ * @param val Valor a revisar
+ * @param mod Modificaciones del ciclo
+ *
+ * @return int Si el valor es invariante
+ */
+int valorInvariante(Valor val, Modificaciones* mod)
+{
+    switch(val.tipo)
+    {
+        case VAL_NUMERO:
+            return 1;
+        case VAL_VARIABLE:
+            return !contieneConjunto(&mod->escalares,val.nombre);
+        case VAL_LISTA_S:
+            return !contieneConjunto(&mod->listas,val.nombre);
+        case VAL_LISTA_F:
+        case VAL_LISTA_L:
+        case VAL_LISTA_T:
+        case VAL_LISTA_N:
+        case VAL_LISTA_X:
+        case VAL_LISTA_INDEX:
+            return !contieneConjunto(&mod->listas,val.nombre) && !contieneConjunto(&mod->escritas,val.nombre);
+        case VAL_LISTA_P:
+            return !contieneConjunto(&mod->listas,val.nombre) && !contieneConjunto(&mod->escritas,val.nombre)
+                && !contieneConjunto(&mod->listas,val.var) && !contieneConjunto(&mod->escritas,val.var);
+        case VAL_LISTA_INDEX_VAR:
+            return !contieneConjunto(&mod->listas,val.nombre) && !contieneConjunto(&mod->escritas,val.nombre)
+                && !contieneConjunto(&mod->escalares,val.var);
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Expresion invariante
+ * @ingroup funciones_analisis
+ *
+ * @param expr Expresion a revisar
+ * @param mod Modificaciones del ciclo
+ *
+ * @return int Si todos los valores de la expresion son invariantes
+ */
+int expresionInvariante(Expresion* expr, Modificaciones* mod)
+{
+    if(!expr)
+        return 1;
+
+    if(expr->tipo == EXPR_VALOR)
+        return valorInvariante(expr->valor,mod);
+
+    return expresionInvariante(expr->binaria.izquierda,mod) && expresionInvariante(expr->binaria.derecha,mod);
+}
+
+/**
+ * @brief Expresion segura
+ * @ingroup funciones_analisis
+ *
+ * Una expresion es segura si se puede evaluar antes del ciclo aunque el ciclo no se ejecute,
+ * no puede tener modulo ni division(con --numeric int64 la division entre cero termina el programa),
+ * indices ni el primer o el ultimo elemento de una lista, que terminan el programa si la lista esta vacia.
+ *
+ * @param expr Expresion a revisar
+ *
+ * @return int Si la expresion es segura
+ */
+int expresionSegura(Expresion* expr)
+{
+    if(!expr)
+        return 1;
+
+    if(expr->tipo == EXPR_VALOR)
+        return expr->valor.tipo == VAL_VARIABLE || expr->valor.tipo == VAL_NUMERO
+            || expr->valor.tipo == VAL_LISTA_S || expr->valor.tipo == VAL_LISTA_T;
+
+    if(!strcmp(expr->binaria.oparitmetico,"%") || !strcmp(expr->binaria.oparitmetico,"/"))
+        return 0;
+
+    return expresionSegura(expr->binaria.izquierda) && expresionSegura(expr->binaria.derecha);
+}
+
+/**
+ * @brief Agregar al conjunto
+ * @ingroup funciones_conjunto
+ *
+ * @param conjunto Conjunto donde se agrega
+ * @param nombre Nombre a agregar, no se repite si ya existe
+ */
+void agregarConjunto(Conjunto* conjunto, char* nombre)
+{
+    if(!nombre || contieneConjunto(conjunto,nombre))
+        return;
+
+    conjunto->cantidad++;
+    conjunto->nombres = (char**)realloc(conjunto->nombres,conjunto->cantidad * sizeof(char*));
+    conjunto->nombres[conjunto->cantidad - 1] = strdup(nombre);
+}
+
+/**
+ * @brief Contiene en el conjunto
+ * @ingroup funciones_conjunto
+ *
+ * @param conjunto Conjunto donde se busca
+ * @param nombre Nombre a buscar
+ *
+ * @return int Si el nombre esta en el conjunto
+ */
+int contieneConjunto(Conjunto* conjunto, char* nombre)
+{
+    if(!nombre)
+        return 0;
+
+    for(int i = 0; i < conjunto->cantidad; i++)
+    {
+        if(!strcmp(conjunto->nombres[i],nombre))
+            return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Quitar del conjunto
+ * @ingroup funciones_conjunto
+ *
+ * @param conjunto Conjunto de donde se quita
+ * @param nombre Nombre a quitar
+ */
+void quitarConjunto(Conjunto* conjunto, char* nombre)
+{
+    if(!nombre)
+        return;
+
+    for(int i = 0; i < conjunto->cantidad; i++)
+    {
+        if(!strcmp(conjunto->nombres[i],nombre))
+        {
+            free(conjunto->nombres[i]);
+            conjunto->nombres[i] = conjunto->nombres[conjunto->cantidad - 1];
+            conjunto->cantidad--;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Copiar conjunto
+ * @ingroup funciones_conjunto
+ *
+ * @param destino Conjunto vacio donde se copia
+ * @param origen Conjunto a copiar
+ */
+void copiarConjunto(Conjunto* destino, Conjunto* origen)
+{
+    for(int i = 0; i < origen->cantidad; i++)
+        agregarConjunto(destino,origen->nombres[i]);
+}
+
+/**
+ * @brief Liberar conjunto
+ * @ingroup funciones_conjunto
+ *
+ * @param conjunto Conjunto a liberar
+ */
+void liberarConjunto(Conjunto* conjunto)
+{
+    for(int i = 0; i < conjunto->cantidad; i++)
+        free(conjunto->nombres[i]);
+
+    free(conjunto->nombres);
+    conjunto->nombres = NULL;
+    conjunto->cantidad = 0;
+}
+
+/**
+ * @brief Liberar modificaciones
+ * @ingroup funciones_conjunto
+ *
+ * @param mod Modificaciones a liberar
+ */
+void liberarModificaciones(Modificaciones* mod)
+{
+    liberarConjunto(&mod->escalares);
+    liberarConjunto(&mod->listas);
+    liberarConjunto(&mod->escritas);
+}
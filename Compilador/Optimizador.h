@@ -0,0 +1,85 @@
+/**
+ * @file Optimizador.h
+ * @brief Prototipos y estructuras de las pasadas de optimizacion.
+ *
+ * Este archivo contiene las estructuras necesarias para recorrer
+ * la lista de enunciados y transformarla antes de la traduccion.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+#include "Enunciados.h"
+#include "Opciones.h"
+
+/**
+ * @brief Conjunto de nombres de variables
+ */
+typedef struct {
+    char** nombres; /**< Nombres almacenados */
+    int cantidad; /**< Cantidad de nombres almacenados */
+} Conjunto;
+
+/**
+ * @brief Estado del optimizador durante una pasada
+ */
+typedef struct {
+    int temporales; /**< Contador para nombrar las variables temporales */
+    Conjunto enteros; /**< Variables que solo guardan valores enteros en todo el programa */
+} Optimizador;
+
+/**
+ * @brief Variables y listas que se modifican dentro de un bloque
+ */
+typedef struct {
+    Conjunto escalares; /**< Variables asignadas, leidas o declaradas */
+    Conjunto listas; /**< Listas que cambian de tamaño o se declaran */
+    Conjunto escritas; /**< Listas con asignaciones por indice */
+} Modificaciones;
+
+/**
+ * @defgroup funciones_optimizador Funciones del optimizador
+ * @{
+ */
+void optimizarPrograma(Programa* programa, Opciones* opciones);
+void optimizarBloque(Optimizador* opt, Programa* bloque, Conjunto* enteros);
+void moverInvariantes(Optimizador* opt, Enunciado* ciclo);
+void contarCiclo(Optimizador* opt, Enunciado* ciclo, Conjunto* enteros);
+void reservarCapacidad(Enunciado* ciclo);
+void renombrarValor(Valor* val, char* viejo, char* nuevo);
+void renombrarExpresion(Expresion* expr, char* viejo, char* nuevo);
+void renombrarVariable(Programa* bloque, char* viejo, char* nuevo);
+void inferirEnteros(Programa* programa, Conjunto* enteros);
+void marcarEnteros(Programa* bloque, Conjunto* enteros);
+/** @} */
+
+/**
+ * @defgroup funciones_analisis Funciones de analisis de enunciados
+ * @{
+ */
+void recolectarModificaciones(Programa* bloque, Modificaciones* mod, int conPrevio);
+int valorInvariante(Valor val, Modificaciones* mod);
+int expresionInvariante(Expresion* expr, Modificaciones* mod);
+int expresionSegura(Expresion* expr);
+int pasoAsignacion(Expresion* expr, char* nombre);
+int contarAsignaciones(Programa* bloque, char* nombre);
+int contarAgregados(Programa* cuerpo, char* lista);
+int valorEntero(Valor val, Conjunto* enteros);
+int expresionEntera(Expresion* expr, Conjunto* enteros);
+int expresionAcotada(Expresion* expr, Conjunto* enteros);
+int constantePequena(Expresion* expr);
+void recolectarDeclaradas(Programa* bloque, Conjunto* declaradas);
+int depurarEnteros(Programa* bloque, Conjunto* enteros);
+/** @} */
+
+/**
+ * @defgroup funciones_conjunto Funciones del conjunto de nombres
+ * @{
+ */
+void agregarConjunto(Conjunto* conjunto, char* nombre);
+int contieneConjunto(Conjunto* conjunto, char* nombre);
+void quitarConjunto(Conjunto* conjunto, char* nombre);
+void copiarConjunto(Conjunto* destino, Conjunto* origen);
+void liberarConjunto(Conjunto* conjunto);
+void liberarModificaciones(Modificaciones* mod);
+/** @} */
@@ -0,0 +1,680 @@
+/**
+ * @file Paralelo.c
+ * @brief Implementación del analisis de ciclos paralelos y vectorizables.
+ *
+ * Busca ciclos contados (los que el optimizador ya cambio por un for) cuyas vueltas
+ * no dependen entre si y les guarda las clausulas de OpenMP para el modo --parallel.
+ * Una vuelta solo puede escribir en listas en la posicion del contador, no puede
+ * cambiar el tamaño de ninguna lista, leer o anunciar, y cada variable que escribe
+ * debe ser propia de la vuelta, acumular una suma o producto, o asignarse antes de
+ * leerse sin usarse despues del ciclo. Las sumas en paralelo se hacen en otro orden,
+ * por lo que con flotantes pueden cambiar los ultimos decimales.
+ *
+ * El mismo analisis sirve para que gcc vectorice los ciclos contados: el limite se
+ * convierte a entero antes del ciclo, las listas que solo se usan por indice se copian
+ * a apuntadores restrict y los ciclos independientes llevan #pragma GCC ivdep.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include "Paralelo.h"
+#include "Patrones.h"
+
+/**@cond */
+int asignaPrimero(Programa* cuerpo, char* nombre);
+Expresion* buscarAsignacion(Programa* bloque, char* nombre);
+void agregarLista(FILE* clausulas, const char* inicio, Conjunto* nombres);
+/**@endcond */
+
+/**
+ * @brief Analizar paralelos
+ * @ingroup funciones_paralelo
+ *
+ * Punto de entrada del analisis, se hace despues del analisis de rangos porque en
+ * el modo --checked solo se paralelizan ciclos sin indices que se revisen.
+ *
+ * @param programa Lista de enunciados completa
+ * @param revisados Booleano para saber si los indices que no son seguros se revisan con --checked
+ */
+void analizarParalelos(Programa* programa, int revisados)
+{
+    paralelosBloque(programa,1,revisados);
+}
+
+/**
+ * @brief Paralelos bloque
+ * @ingroup funciones_paralelo
+ *
+ * Marca los ciclos del bloque que se pueden hacer en paralelo. Si un ciclo no se
+ * puede se buscan ciclos dentro de el, pero nunca se marcan dos ciclos anidados.
+ *
+ * @param bloque Bloque a recorrer
+ * @param principal Booleano para saber si es el bloque principal del programa
+ * @param revisados Booleano para saber si los indices que no son seguros se revisan con --checked
+ */
+void paralelosBloque(Programa* bloque, int principal, int revisados)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        if(e->tipo == ENUNC_SI)
+        {
+            paralelosBloque(e->si.entonces,0,revisados);
+            paralelosBloque(e->si.si_no,0,revisados);
+        }
+        else if(e->tipo == ENUNC_MIENTRAS)
+        {
+            Compartidas compartidas = {0};
+            if(e->mientras.contador && cicloParalelo(bloque,e,principal,&compartidas,revisados))
+                e->mientras.paralelo = escribirClausulas(&compartidas);
+            else
+                paralelosBloque(e->mientras.cuerpo,0,revisados);
+
+            liberarConjunto(&compartidas.privadas);
+            liberarConjunto(&compartidas.sumas);
+            liberarConjunto(&compartidas.productos);
+        }
+    }
+}
+
+/**
+ * @brief Ciclo paralelo
+ * @ingroup funciones_paralelo
+ *
+ * @param bloque Bloque donde esta el ciclo
+ * @param ciclo Ciclo contado a revisar
+ * @param principal Booleano para saber si el bloque es el principal
+ * @param compartidas Donde se guardan las variables que necesitan clausula
+ * @param revisados Booleano para saber si los indices que no son seguros se revisan con --checked
+ *
+ * @return int Si las vueltas del ciclo se pueden hacer en cualquier orden
+ */
+int cicloParalelo(Programa* bloque, Enunciado* ciclo, int principal, Compartidas* compartidas, int revisados)
+{
+    Mientras* m = &ciclo->mientras;
+
+    if(m->comp.izquierda.tipo != VAL_VARIABLE || strcmp(m->comp.izquierda.nombre,m->contador))
+        return 0;
+
+    if(!enunciadosPermitidos(m->cuerpo))
+        return 0;
+
+    Modificaciones mod = {0};
+    recolectarModificaciones(m->cuerpo,&mod,1);
+
+    int valido = mod.listas.cantidad == 0 && valorInvariante(m->comp.derecha,&mod)
+        && accesosIndependientes(m->cuerpo,m->contador,&mod.escritas,revisados);
+
+    //Las declaradas y los contadores internos se escriben dentro del cuerpo, ya son de cada hilo
+    Conjunto locales = {0};
+    recolectarDeclaradas(m->cuerpo,&locales);
+    recolectarContadores(m->cuerpo,&locales);
+
+    for(int i = 0; valido && i < mod.escalares.cantidad; i++)
+    {
+        char* nombre = mod.escalares.nombres[i];
+        if(contieneConjunto(&locales,nombre))
+            continue;
+
+        int reduccion = tipoReduccion(m->cuerpo,nombre);
+        if(reduccion == '+')
+            agregarConjunto(&compartidas->sumas,nombre);
+        else if(reduccion == '*')
+            agregarConjunto(&compartidas->productos,nombre);
+        else if(asignaPrimero(m->cuerpo,nombre) && variableMuerta(bloque,ciclo->siguiente,nombre,principal))
+            agregarConjunto(&compartidas->privadas,nombre);
+        else
+            valido = 0;
+    }
+
+    liberarConjunto(&locales);
+    liberarModificaciones(&mod);
+    return valido;
+}
+
+/**
+ * @brief Enunciados permitidos
+ * @ingroup funciones_paralelo
+ *
+ * Solo se permiten declaraciones de variables, asignaciones, si y ciclos. Leer,
+ * anunciar o cambiar el tamaño de una lista depende del orden de las vueltas.
+ *
+ * @param bloque Bloque a revisar
+ *
+ * @return int Si todos los enunciados del bloque se pueden hacer en paralelo
+ */
+int enunciadosPermitidos(Programa* bloque)
+{
+    if(!bloque)
+        return 1;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_DECLARACION:
+            case ENUNC_ASIGNACION:
+                break;
+            case ENUNC_SI:
+                if(!enunciadosPermitidos(e->si.entonces) || !enunciadosPermitidos(e->si.si_no))
+                    return 0;
+                break;
+            case ENUNC_MIENTRAS:
+                if(!enunciadosPermitidos(e->mientras.previo) || !enunciadosPermitidos(e->mientras.cuerpo))
+                    return 0;
+                break;
+            default:
+                return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Accesos independientes
+ * @ingroup funciones_paralelo
+ *
+ * Las listas que se escriben en el ciclo solo se pueden escribir y leer en la
+ * posicion del contador, asi cada vuelta usa un elemento distinto.
+ *
+ * @param bloque Bloque a revisar
+ * @param contador Contador del ciclo paralelo
+ * @param escritas Listas que se escriben dentro del ciclo
+ * @param revisados Booleano para saber si los indices que no son seguros se revisan con --checked
+ *
+ * @return int Si ninguna vuelta lee o escribe lo que escribe otra
+ */
+int accesosIndependientes(Programa* bloque, char* contador, Conjunto* escritas, int revisados)
+{
+    if(!bloque)
+        return 1;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_ASIGNACION:
+            {
+                Valor destino = e->asignacion.variable;
+                if(destino.tipo == VAL_LISTA_INDEX || (destino.tipo == VAL_LISTA_INDEX_VAR && strcmp(destino.var,contador)))
+                    return 0;
+                if(!valorIndependiente(destino,contador,escritas,revisados) || !expresionIndependiente(e->asignacion.expresion,contador,escritas,revisados))
+                    return 0;
+                break;
+            }
+            case ENUNC_SI:
+                if(!valorIndependiente(e->si.comp.izquierda,contador,escritas,revisados) || !valorIndependiente(e->si.comp.derecha,contador,escritas,revisados)
+                    || !accesosIndependientes(e->si.entonces,contador,escritas,revisados) || !accesosIndependientes(e->si.si_no,contador,escritas,revisados))
+                    return 0;
+                break;
+            case ENUNC_MIENTRAS:
+                if(!valorIndependiente(e->mientras.comp.izquierda,contador,escritas,revisados) || !valorIndependiente(e->mientras.comp.derecha,contador,escritas,revisados)
+                    || !accesosIndependientes(e->mientras.previo,contador,escritas,revisados) || !accesosIndependientes(e->mientras.cuerpo,contador,escritas,revisados))
+                    return 0;
+                break;
+            default:
+                break;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Valor independiente
+ * @ingroup funciones_paralelo
+ *
+ * @param val Valor a revisar
+ * @param contador Contador del ciclo paralelo
+ * @param escritas Listas que se escriben dentro del ciclo
+ * @param revisados Booleano para saber si los indices que no son seguros se revisan con --checked
+ *
+ * @return int Si el valor no lee elementos que escribe otra vuelta
+ */
+int valorIndependiente(Valor val, char* contador, Conjunto* escritas, int revisados)
+{
+    //Un indice revisado puede terminar el programa desde cualquier hilo
+    if(revisados && (val.tipo == VAL_LISTA_INDEX || val.tipo == VAL_LISTA_INDEX_VAR) && !val.seguro)
+        return 0;
+
+    if(val.tipo == VAL_LISTA_P && contieneConjunto(escritas,val.var))
+        return 0;
+
+    if(val.tipo == VAL_VARIABLE || val.tipo == VAL_NUMERO || !contieneConjunto(escritas,val.nombre))
+        return 1;
+
+    return val.tipo == VAL_LISTA_S || (val.tipo == VAL_LISTA_INDEX_VAR && !strcmp(val.var,contador));
+}
+
+/**
+ * @brief Expresion independiente
+ * @ingroup funciones_paralelo
+ *
+ * @param expr Expresion a revisar
+ * @param contador Contador del ciclo paralelo
+ * @param escritas Listas que se escriben dentro del ciclo
+ * @param revisados Booleano para saber si los indices que no son seguros se revisan con --checked
+ *
+ * @return int Si ningun valor de la expresion lee elementos que escribe otra vuelta
+ */
+int expresionIndependiente(Expresion* expr, char* contador, Conjunto* escritas, int revisados)
+{
+    if(!expr)
+        return 1;
+
+    if(expr->tipo == EXPR_VALOR)
+        return valorIndependiente(expr->valor,contador,escritas,revisados);
+
+    return expresionIndependiente(expr->binaria.izquierda,contador,escritas,revisados)
+        && expresionIndependiente(expr->binaria.derecha,contador,escritas,revisados);
+}
+
+/**
+ * @brief Tipo de reduccion
+ * @ingroup funciones_paralelo
+ *
+ * Una variable es una suma si su unica aparicion en el cuerpo es nombre = nombre + ...,
+ * nombre = nombre - ... o ... + nombre, y es un producto si la expresion solo tiene *.
+ * Las expresiones se escriben planas en C, por eso nombre + a * b sigue siendo una
+ * suma. La division no se acepta en productos porque con enteros trunca.
+ *
+ * @param cuerpo Cuerpo del ciclo
+ * @param nombre Variable a revisar
+ *
+ * @return int '+' si es suma, '*' si es producto y 0 si no es reduccion
+ */
+int tipoReduccion(Programa* cuerpo, char* nombre)
+{
+    if(contarAsignaciones(cuerpo,nombre) != 1 || contarUsos(cuerpo,nombre) != 1)
+        return 0;
+
+    Expresion* expr = buscarAsignacion(cuerpo,nombre);
+    if(!expr || expr->tipo != EXPR_BINARIA)
+        return 0;
+
+    //Operador antes y despues de la variable, y si todos son multiplicaciones
+    char* antes = NULL;
+    char* despues = NULL;
+    int apariciones = 0, multiplicativa = 1;
+    char* anterior = NULL;
+
+    for(Expresion* actual = expr; actual != NULL;)
+    {
+        if(actual->tipo == EXPR_BINARIA && actual->binaria.izquierda->tipo != EXPR_VALOR)
+            return 0;
+
+        Valor val = actual->tipo == EXPR_VALOR ? actual->valor : actual->binaria.izquierda->valor;
+        char* op = actual->tipo == EXPR_BINARIA ? actual->binaria.oparitmetico : NULL;
+
+        if(op && strcmp(op,"*"))
+            multiplicativa = 0;
+
+        if(usaValor(val,nombre))
+        {
+            if(val.tipo != VAL_VARIABLE)
+                return 0;
+            apariciones++;
+            antes = anterior;
+            despues = op;
+        }
+
+        anterior = op;
+        actual = actual->tipo == EXPR_BINARIA ? actual->binaria.derecha : NULL;
+    }
+
+    if(apariciones != 1)
+        return 0;
+
+    //La variable es un termino suelto de la suma
+    int sueltaAntes = !antes || !strcmp(antes,"+");
+    int sueltaDespues = !despues || !strcmp(despues,"+") || !strcmp(despues,"-");
+    if(sueltaAntes && sueltaDespues)
+        return '+';
+
+    if(multiplicativa)
+        return '*';
+
+    return 0;
+}
+
+/**
+ * @brief Contar usos
+ * @ingroup funciones_paralelo
+ *
+ * @param bloque Bloque a revisar
+ * @param nombre Variable a buscar
+ *
+ * @return int Cantidad de enunciados simples y condiciones que mencionan la variable
+ */
+int contarUsos(Programa* bloque, char* nombre)
+{
+    int cantidad = 0;
+    if(!bloque)
+        return 0;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        if(e->tipo == ENUNC_SI)
+            cantidad += (usaValor(e->si.comp.izquierda,nombre) || usaValor(e->si.comp.derecha,nombre))
+                + contarUsos(e->si.entonces,nombre) + contarUsos(e->si.si_no,nombre);
+        else if(e->tipo == ENUNC_MIENTRAS)
+            cantidad += (usaValor(e->mientras.comp.izquierda,nombre) || usaValor(e->mientras.comp.derecha,nombre)
+                || (e->mientras.inductor && !strcmp(e->mientras.inductor,nombre)))
+                + contarUsos(e->mientras.previo,nombre) + contarUsos(e->mientras.cuerpo,nombre);
+        else
+            cantidad += usaEnunciado(e,nombre);
+    }
+
+    return cantidad;
+}
+
+/**
+ * @brief Recolectar contadores
+ * @ingroup funciones_paralelo
+ *
+ * @param bloque Bloque a revisar
+ * @param contadores Conjunto donde se guardan los contadores de los ciclos internos
+ */
+void recolectarContadores(Programa* bloque, Conjunto* contadores)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        if(e->tipo == ENUNC_SI)
+        {
+            recolectarContadores(e->si.entonces,contadores);
+            recolectarContadores(e->si.si_no,contadores);
+        }
+        else if(e->tipo == ENUNC_MIENTRAS)
+        {
+            if(e->mientras.contador)
+                agregarConjunto(contadores,e->mientras.contador);
+            recolectarContadores(e->mientras.previo,contadores);
+            recolectarContadores(e->mientras.cuerpo,contadores);
+        }
+    }
+}
+
+/**
+ * @brief Escribir clausulas
+ * @ingroup funciones_paralelo
+ *
+ * @param compartidas Variables que necesitan clausula
+ *
+ * @return char* Clausulas private y reduction para el pragma, puede ser vacia
+ */
+char* escribirClausulas(Compartidas* compartidas)
+{
+    //Las clausulas pueden tener cualquier cantidad de variables, por eso se escriben en memoria que crece
+    char* clausulas = NULL;
+    size_t tam = 0;
+    FILE* fptr = open_memstream(&clausulas,&tam);
+    agregarLista(fptr," private(",&compartidas->privadas);
+    agregarLista(fptr," reduction(+:",&compartidas->sumas);
+    agregarLista(fptr," reduction(*:",&compartidas->productos);
+    fclose(fptr);
+    return clausulas;
+}
+
+/**
+ * @brief Analizar vectores
+ * @ingroup funciones_paralelo
+ *
+ * Recorre todos los ciclos contados del bloque, tambien los que estan dentro de otros,
+ * y guarda lo que necesita el traductor para escribirlos de forma vectorizable.
+ *
+ * @param bloque Bloque a recorrer
+ * @param revisados Booleano para saber si los indices que no son seguros se revisan con --checked
+ */
+void analizarVectores(Programa* bloque, int revisados)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        if(e->tipo == ENUNC_SI)
+        {
+            analizarVectores(e->si.entonces,revisados);
+            analizarVectores(e->si.si_no,revisados);
+        }
+        else if(e->tipo == ENUNC_MIENTRAS)
+        {
+            if(e->mientras.contador)
+                vectorCiclo(&e->mientras,revisados);
+            analizarVectores(e->mientras.previo,revisados);
+            analizarVectores(e->mientras.cuerpo,revisados);
+        }
+    }
+}
+
+/**
+ * @brief Vector ciclo
+ * @ingroup funciones_paralelo
+ *
+ * Un arreglo copiado a una variable local solo es valido si la lista no cambia de
+ * tamaño en el ciclo, y el apuntador solo puede ser restrict si ninguna funcion de la
+ * lista lo lee por otro lado. Dos listas distintas nunca comparten memoria.
+ *
+ * @param m Ciclo contado a revisar
+ * @param revisados Booleano para saber si los indices que no son seguros se revisan con --checked
+ */
+void vectorCiclo(Mientras* m, int revisados)
+{
+    Modificaciones mod = {0};
+    recolectarModificaciones(m->cuerpo,&mod,1);
+
+    m->limiteFijo = m->comp.izquierda.tipo == VAL_VARIABLE && !strcmp(m->comp.izquierda.nombre,m->contador)
+        && valorInvariante(m->comp.derecha,&mod);
+    m->independiente = m->limiteFijo && mod.listas.cantidad == 0 && enunciadosPermitidos(m->cuerpo)
+        && accesosIndependientes(m->cuerpo,m->contador,&mod.escritas,revisados);
+
+    Conjunto usadas = {0}, prohibidas = {0}, arreglos = {0};
+    arregloValor(m->comp.izquierda,&usadas,&prohibidas);
+    arregloValor(m->comp.derecha,&usadas,&prohibidas);
+    recolectarArreglos(m->cuerpo,&usadas,&prohibidas);
+
+    for(int i = 0; i < usadas.cantidad; i++)
+        if(!contieneConjunto(&prohibidas,usadas.nombres[i]) && !contieneConjunto(&mod.listas,usadas.nombres[i]))
+            agregarConjunto(&arreglos,usadas.nombres[i]);
+
+    m->arreglos = arreglos.nombres;
+    m->cantidadArreglos = arreglos.cantidad;
+
+    liberarConjunto(&usadas);
+    liberarConjunto(&prohibidas);
+    liberarModificaciones(&mod);
+}
+
+/**
+ * @brief Recolectar arreglos
+ * @ingroup funciones_paralelo
+ *
+ * @param bloque Bloque a revisar
+ * @param usadas Listas que se usan por indice o tamaño
+ * @param prohibidas Listas que se usan completas, con una funcion de la libreria
+ */
+void recolectarArreglos(Programa* bloque, Conjunto* usadas, Conjunto* prohibidas)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_DECLARACION_LISTA:
+                for(int i = 0; i < e->declaracion.cantidad; i++)
+                    agregarConjunto(prohibidas,e->declaracion.variables[i]);
+                break;
+            case ENUNC_ASIGNACION:
+                arregloValor(e->asignacion.variable,usadas,prohibidas);
+                arregloExpresion(e->asignacion.expresion,usadas,prohibidas);
+                break;
+            case ENUNC_ASIGNACION_LISTA:
+                agregarConjunto(prohibidas,e->asignacion.variable.nombre);
+                arregloExpresion(e->asignacion.expresion,usadas,prohibidas);
+                break;
+            case ENUNC_LEER_LISTA:
+            case ENUNC_LEER_TODO:
+                agregarConjunto(prohibidas,e->leer.variable);
+                break;
+            case ENUNC_ANUNCIAR:
+                if(!e->anunciar.esCadena)
+                    arregloExpresion(e->anunciar.expresion,usadas,prohibidas);
+                break;
+            case ENUNC_SI:
+                arregloValor(e->si.comp.izquierda,usadas,prohibidas);
+                arregloValor(e->si.comp.derecha,usadas,prohibidas);
+                recolectarArreglos(e->si.entonces,usadas,prohibidas);
+                recolectarArreglos(e->si.si_no,usadas,prohibidas);
+                break;
+            case ENUNC_MIENTRAS:
+                arregloValor(e->mientras.comp.izquierda,usadas,prohibidas);
+                arregloValor(e->mientras.comp.derecha,usadas,prohibidas);
+                recolectarArreglos(e->mientras.previo,usadas,prohibidas);
+                recolectarArreglos(e->mientras.cuerpo,usadas,prohibidas);
+                break;
+            case ENUNC_RESERVAR_LISTA:
+                agregarConjunto(prohibidas,e->reservar.lista);
+                break;
+            case ENUNC_ORDENAR:
+                agregarConjunto(prohibidas,e->ordenar.lista);
+                break;
+            case ENUNC_OPERAR_LISTA:
+                agregarConjunto(prohibidas,e->operar.lista);
+                arregloExpresion(e->operar.expresion,usadas,prohibidas);
+                break;
+            case ENUNC_ANUNCIAR_LISTA:
+                agregarConjunto(prohibidas,e->anunciarLista.lista);
+                break;
+            case ENUNC_GUARDAR_LISTA:
+            case ENUNC_CARGAR_LISTA:
+                agregarConjunto(prohibidas,e->archivo.lista);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Arreglo valor
+ * @ingroup funciones_paralelo
+ *
+ * @param val Valor a revisar
+ * @param usadas Listas que se usan por indice o tamaño
+ * @param prohibidas Listas que se usan completas, con una funcion de la libreria
+ */
+void arregloValor(Valor val, Conjunto* usadas, Conjunto* prohibidas)
+{
+    switch(val.tipo)
+    {
+        case VAL_VARIABLE:
+        case VAL_NUMERO:
+            break;
+        case VAL_LISTA_INDEX:
+        case VAL_LISTA_INDEX_VAR:
+        case VAL_LISTA_S:
+            agregarConjunto(usadas,val.nombre);
+            break;
+        case VAL_LISTA_P:
+            agregarConjunto(prohibidas,val.var);
+            agregarConjunto(prohibidas,val.nombre);
+            break;
+        default:
+            agregarConjunto(prohibidas,val.nombre);
+            break;
+    }
+}
+
+/**
+ * @brief Arreglo expresion
+ * @ingroup funciones_paralelo
+ *
+ * @param expr Expresion a revisar
+ * @param usadas Listas que se usan por indice o tamaño
+ * @param prohibidas Listas que se usan completas, con una funcion de la libreria
+ */
+void arregloExpresion(Expresion* expr, Conjunto* usadas, Conjunto* prohibidas)
+{
+    if(!expr)
+        return;
+
+    if(expr->tipo == EXPR_VALOR)
+        arregloValor(expr->valor,usadas,prohibidas);
+    else
+    {
+        arregloExpresion(expr->binaria.izquierda,usadas,prohibidas);
+        arregloExpresion(expr->binaria.derecha,usadas,prohibidas);
+    }
+}
+
+/**@cond */
+
+/*
+ * Revisa si el primer enunciado del cuerpo que menciona la variable le asigna sin leerla
+ */
+int asignaPrimero(Programa* cuerpo, char* nombre)
+{
+    for(Enunciado* e = cuerpo->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        if(!usaEnunciado(e,nombre))
+            continue;
+
+        return e->tipo == ENUNC_ASIGNACION && e->asignacion.variable.tipo == VAL_VARIABLE
+            && !strcmp(e->asignacion.variable.nombre,nombre) && !usaExpresion(e->asignacion.expresion,nombre);
+    }
+
+    return 0;
+}
+
+/*
+ * Regresa la expresion de la primera asignacion a la variable en el bloque o sus bloques internos
+ */
+Expresion* buscarAsignacion(Programa* bloque, char* nombre)
+{
+    if(!bloque)
+        return NULL;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        Expresion* expr = NULL;
+        if(e->tipo == ENUNC_ASIGNACION && e->asignacion.variable.tipo == VAL_VARIABLE && !strcmp(e->asignacion.variable.nombre,nombre))
+            return e->asignacion.expresion;
+        else if(e->tipo == ENUNC_SI)
+            expr = buscarAsignacion(e->si.entonces,nombre) ? buscarAsignacion(e->si.entonces,nombre) : buscarAsignacion(e->si.si_no,nombre);
+        else if(e->tipo == ENUNC_MIENTRAS)
+            expr = buscarAsignacion(e->mientras.previo,nombre) ? buscarAsignacion(e->mientras.previo,nombre) : buscarAsignacion(e->mientras.cuerpo,nombre);
+
+        if(expr)
+            return expr;
+    }
+
+    return NULL;
+}
+
+/*
+ * Agrega inicio y los nombres separados por comas, si no hay nombres no agrega nada
+ */
+void agregarLista(FILE* clausulas, const char* inicio, Conjunto* nombres)
+{
+    if(!nombres->cantidad)
+        return;
+
+    fputs(inicio,clausulas);
+    for(int i = 0; i < nombres->cantidad; i++)
+    {
+        if(i > 0)
+            fputc(',',clausulas);
+        fputs(nombres->nombres[i],clausulas);
+    }
+    fputc(')',clausulas);
+}
+
+/**@endcond */
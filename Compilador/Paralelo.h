@@ -0,0 +1,49 @@
+/**
+ * @file Paralelo.h
+ * @brief Prototipos del analisis de ciclos paralelos y vectorizables.
+ *
+ * Este archivo contiene las funciones que revisan si las vueltas de un
+ * ciclo contado no dependen entre si, para escribirlo con OpenMP en el
+ * modo --parallel o con una forma que gcc pueda vectorizar.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+#include "Optimizador.h"
+
+/**
+ * @brief Ciclos con menos vueltas que esto se hacen en un solo hilo
+ */
+#define VUELTAS_PARALELO 10000
+
+/**
+ * @brief Variables escalares que se escriben dentro de un ciclo paralelo
+ */
+typedef struct {
+    Conjunto privadas; /**< Variables que cada vuelta asigna antes de leer y no se leen despues del ciclo */
+    Conjunto sumas; /**< Variables que solo acumulan con + o - */
+    Conjunto productos; /**< Variables que solo acumulan con * */
+} Compartidas;
+
+/**
+ * @defgroup funciones_paralelo Funciones del analisis de ciclos paralelos
+ * @{
+ */
+void analizarParalelos(Programa* programa, int revisados);
+void paralelosBloque(Programa* bloque, int principal, int revisados);
+int cicloParalelo(Programa* bloque, Enunciado* ciclo, int principal, Compartidas* compartidas, int revisados);
+int enunciadosPermitidos(Programa* bloque);
+int accesosIndependientes(Programa* bloque, char* contador, Conjunto* escritas, int revisados);
+int valorIndependiente(Valor val, char* contador, Conjunto* escritas, int revisados);
+int expresionIndependiente(Expresion* expr, char* contador, Conjunto* escritas, int revisados);
+int tipoReduccion(Programa* cuerpo, char* nombre);
+int contarUsos(Programa* bloque, char* nombre);
+void recolectarContadores(Programa* bloque, Conjunto* contadores);
+char* escribirClausulas(Compartidas* compartidas);
+void analizarVectores(Programa* bloque, int revisados);
+void vectorCiclo(Mientras* m, int revisados);
+void recolectarArreglos(Programa* bloque, Conjunto* usadas, Conjunto* prohibidas);
+void arregloValor(Valor val, Conjunto* usadas, Conjunto* prohibidas);
+void arregloExpresion(Expresion* expr, Conjunto* usadas, Conjunto* prohibidas);
+/** @} */
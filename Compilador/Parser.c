@@ -10,71 +10,71 @@
 
 #include "Lexer.h"
 #include "SymbolTable.h"
+#include "Contexto.h"
 
 /**@cond */
-int analizar(Tokens* tokens, Pila *scopes);
-int programa(Tokens* tokens, Pila *scopes);
-int enunciados(Tokens *tokens, Pila *scopes);
-int enunciado(Tokens *tokens, Pila *scopes);
-int variables(Tokens *tokens, Pila *scopes);
-int asignacion(Tokens *tokens, Pila *scopes);
-int lista(Tokens *tokens, Pila *scopes);
-int expresion(Tokens *tokens, Pila *scopes,char* nombreVar);
-int expresionLista(Tokens *tokens, Pila *scopes,char* nombreVar);
-int anunciar(Tokens *tokens, Pila *scopes);
-int si(Tokens *tokens, Pila *scopes);
-int mientras(Tokens *tokens, Pila *scopes);
-int comparacion(Tokens *tokens, Pila *scopes);
-int valor(Tokens* tokens, Pila *scopes, char* nombreVar);
+int analizar(Contexto* ctx, Tokens* tokens, Pila *scopes);
+int programa(Contexto* ctx, Tokens* tokens, Pila *scopes);
+int enunciados(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int enunciado(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int variables(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int asignacion(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int lista(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int expresion(Contexto* ctx, Tokens *tokens, Pila *scopes,char* nombreVar);
+int expresionLista(Contexto* ctx, Tokens *tokens, Pila *scopes,char* nombreVar);
+int anunciar(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int si(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int mientras(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int comparacion(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int valor(Contexto* ctx, Tokens* tokens, Pila *scopes, char* nombreVar);
 int oprelacional(Tokens *tokens, Pila *scopes);
+int ordenar(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int archivoLista(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int operarLista(Contexto* ctx, Tokens *tokens, Pila *scopes);
+int esLista(Tokens *tokens, Pila *scopes);
+int revisarVariable(Contexto* ctx, Tokens *tokens, Pila *scopes);
 
-void term(Tokens* tokens, Pila *scopes);
+void term(Contexto* ctx, Tokens* tokens, Pila *scopes);
 void borrarTodo(Pila *scopes);
 /**@endcond */
 
-/**
- * @brief Booleano global para saber si entre a una declaracion de variables, una declaracion de variables lista o no
- */
-int declaracion = 0;
-/**
- * @brief Contador global para saber el total de líneas de mi documento
- */
-int linea = 1;
 
 HashMap* crearScope();
 
-/**
- * @brief Copia global que representa una copia de mi tabla de simbolos.
- */
-Pila copia;
-
 /**
  * @brief Parser
  * @ingroup funciones_compilador
  * 
- * Método que genera una tabla de símbolos y analiza la lista de tokens.
+ * Método que genera una tabla de símbolos y analiza la lista de tokens del contexto.
+ * La tabla completa queda en la copia del contexto, aunque haya un error.
  * 
- * @param filename Nombre del archivo a revisar
- * @param tokens Lista de tokens.
+ * @param ctx Contexto de la compilacion con los tokens del archivo
+ *
+ * @return int Si esta todo correcto
  */
-int parser(char *filename, Tokens *tokens)
+int parser(Contexto* ctx)
 {
+	Tokens *tokens = &ctx->tokens;
 	Pila scopes;
 	inicializarPila(&scopes);
-	inicializarPila(&copia);
+	inicializarPila(&ctx->copia);
 	push(&scopes,crearScope());
 
-	if(analizar(tokens,&scopes))
+	//term regresa aqui con la tabla de simbolos ya en la copia
+	if(setjmp(ctx->error))
+		return 0;
+
+	if(analizar(ctx,tokens,&scopes))
 	{
 		//borrarTodo(&scopes);
-		push(&copia,scopes.head->scope);
+		push(&ctx->copia,scopes.head->scope);
 		pop(&scopes);
 		return 1;
 	}
 
 	//borrarTodo(&scopes);
 
-	term(tokens,&scopes);
+	term(ctx,tokens,&scopes);
 	
 	return 0;
 }
@@ -84,14 +84,15 @@ int parser(char *filename, Tokens *tokens)
  * 
  * Analiza la lista de tokens y para si encuentra algo incorrecto
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens.
  * @param scopes Tabla de símbolos.
  * 
  * @return int Si esta todo correcto.
  */
-int analizar(Tokens* tokens, Pila *scopes)
+int analizar(Contexto* ctx, Tokens* tokens, Pila *scopes)
 {
-	if(programa(tokens,scopes))
+	if(programa(ctx,tokens,scopes))
 		return 1;
 	else
 		return 0;
@@ -103,38 +104,38 @@ int analizar(Tokens* tokens, Pila *scopes)
  * Analiza si el programa inicializa y termina con los tokens
  * correctos
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  * @return int Si esta todo correcto
  */
 //<Programa> -> raw <Enunciados> smackdown
-int programa(Tokens* tokens, Pila *scopes)
+int programa(Contexto* ctx, Tokens* tokens, Pila *scopes)
 {
 	if(!strcmp(tokens->actual->token->tipoToken,"INICIO-PROGRAMA"))
 	{
 		push(scopes,crearScope());
 
 		tokens->actual = tokens->actual->next;
-		if(enunciados(tokens,scopes)){}
+		if(enunciados(ctx,tokens,scopes)){}
 		while(tokens->actual && !strcmp(tokens->actual->token->tipoToken,"FIN-LINEA")){
-			linea++;
 			tokens->actual = tokens->actual->next;
 		}
 		if(!strcmp(tokens->actual->token->tipoToken,"FIN-PROGRAMA"))
 		{
-			push(&copia,scopes->head->scope);
+			push(&ctx->copia,scopes->head->scope);
 			pop(scopes);
 			return 1;
 		}
 		else
 		{
-			printf("Se esperaba \"smackdown\", se encontro %s\n",tokens->actual->token->cadena);
+			errorCompilacion(ctx,"Se esperaba \"smackdown\", se encontro %s",tokens->actual->token->cadena);
 			return 0;
 		}
 	}
 	else
-		printf("Se esperaba \"raw\", se encontro: %s\n",tokens->actual->token->cadena);
+		errorCompilacion(ctx,"Se esperaba \"raw\", se encontro: %s",tokens->actual->token->cadena);
 	
 	return 0;
 }
@@ -144,17 +145,18 @@ int programa(Tokens* tokens, Pila *scopes)
  * 
  * Analiza cada enunciado
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  * @return int Si esta todo correcto
  */
 //<Enunciados> -> <Enunciado> <Enunciados> | <Enunciado>
-int enunciados(Tokens *tokens, Pila *scopes)
+int enunciados(Contexto* ctx, Tokens *tokens, Pila *scopes)
 {
-	if(enunciado(tokens,scopes))
+	if(enunciado(ctx,tokens,scopes))
 	{
-		while(enunciado(tokens,scopes));
+		while(enunciado(ctx,tokens,scopes));
 		return 1;
 	}
 
@@ -167,21 +169,21 @@ int enunciados(Tokens *tokens, Pila *scopes)
  * A diferencia de Enunciados, analiza cada enunciado uno por uno
  * y llama al método correspondiente
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  * @return int Si esta todo correcto
  */
-//<Enunciado> -> <Declaracion> | <Asignacion> | <Anunciar> | <Si> | <Mientras> 
-int enunciado(Tokens *tokens, Pila *scopes)
+//<Enunciado> -> <Declaracion> | <Asignacion> | <Anunciar> | <Si> | <Mientras> | <Ordenar>
+int enunciado(Contexto* ctx, Tokens *tokens, Pila *scopes)
 {
 	//printf("Analizando token: %s con lexeme: %s\n",tokens->actual->token->tipoToken,tokens->actual->token->cadena);
-	declaracion = 0;
+	ctx->declaracion = 0;
 	Nodo *prev = tokens->actual;
 
 	if(!strcmp(tokens->actual->token->tipoToken,"FIN-LINEA"))
 	{
-		linea++;
 		tokens->actual = tokens->actual->next;
 		return 1;
 	}
@@ -191,9 +193,9 @@ int enunciado(Tokens *tokens, Pila *scopes)
 	if(!strcmp(tokens->actual->token->tipoToken,"INICIALIZAR"))
 	{
 		//printf("INICIALIZAR\n");
-		declaracion = 1;
+		ctx->declaracion = 1;
 		tokens->actual = tokens->actual->next;
-		if(variables(tokens,scopes))
+		if(variables(ctx,tokens,scopes))
 		{
 			return 1;
 		}
@@ -204,9 +206,9 @@ int enunciado(Tokens *tokens, Pila *scopes)
 	if(!strcmp(tokens->actual->token->tipoToken,"NEXUS"))
 	{
 		//printf("INICIALIZAR LISTAS\n");
-		declaracion = 2;
+		ctx->declaracion = 2;
 		tokens->actual = tokens->actual->next;
-		if(variables(tokens,scopes))
+		if(variables(ctx,tokens,scopes))
 		{
 			return 1;
 		}
@@ -218,10 +220,9 @@ int enunciado(Tokens *tokens, Pila *scopes)
 	{
 		//printf("ASIGNACION\n");
 
-		if(!intermedia(scopes,tokens->actual->token->cadena,*tokens->actual->token,declaracion))
-			term(tokens,scopes);
+		revisarVariable(ctx,tokens,scopes);
 		tokens->actual = tokens->actual->next;
-		if(asignacion(tokens,scopes))
+		if(asignacion(ctx,tokens,scopes))
 			return 1;
 	}
 
@@ -231,7 +232,7 @@ int enunciado(Tokens *tokens, Pila *scopes)
 	{
 		//printf("ANUNCIAR\n");
 		tokens->actual = tokens->actual->next;
-		if(anunciar(tokens,scopes))
+		if(anunciar(ctx,tokens,scopes))
 			return 1;
 	}
 
@@ -244,7 +245,7 @@ int enunciado(Tokens *tokens, Pila *scopes)
 		//push(&copia,crearScope());
 
 		tokens->actual = tokens->actual->next;
-		if(si(tokens,scopes))
+		if(si(ctx,tokens,scopes))
 			return 1;
 	}
 
@@ -257,7 +258,25 @@ int enunciado(Tokens *tokens, Pila *scopes)
 		//push(&copia,crearScope());
 
 		tokens->actual = tokens->actual->next;
-		if(mientras(tokens,scopes))
+		if(mientras(ctx,tokens,scopes))
+			return 1;
+	}
+
+	tokens->actual = prev;
+
+	if(!strcmp(tokens->actual->token->tipoToken,"ORDENAR"))
+	{
+		tokens->actual = tokens->actual->next;
+		if(ordenar(ctx,tokens,scopes))
+			return 1;
+	}
+
+	tokens->actual = prev;
+
+	if(!strcmp(tokens->actual->token->tipoToken,"GUARDAR") || !strcmp(tokens->actual->token->tipoToken,"CARGAR"))
+	{
+		tokens->actual = tokens->actual->next;
+		if(archivoLista(ctx,tokens,scopes))
 			return 1;
 	}
 
@@ -265,8 +284,8 @@ int enunciado(Tokens *tokens, Pila *scopes)
 
 	if(!strcmp(tokens->actual->token->tipoToken,"NOT_TOKEN"))
 	{
-		printf("La palabra %s no es una palabra reservada valida\n",tokens->actual->token->cadena);
-		term(tokens,scopes);
+		errorCompilacion(ctx,"La palabra %s no es una palabra reservada valida",tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
 		return 0;
 	}
 
@@ -275,8 +294,8 @@ int enunciado(Tokens *tokens, Pila *scopes)
 	if(!strcmp(tokens->actual->token->tipoToken,"NUM") || !strcmp(tokens->actual->token->tipoToken,"FLOAT") || !strcmp(tokens->actual->token->tipoToken,"OPARITMETICO") || !strcmp(tokens->actual->token->tipoToken,"OPRELACIONAL"))
 	{
 		//printf("Token mal: %s\n",tokens->actual->token->cadena);
-		printf("Formato no permitido\n");
-		term(tokens,scopes);
+		errorCompilacion(ctx,"Formato no permitido");
+		term(ctx,tokens,scopes);
 		return 0;
 	}
 
@@ -288,13 +307,14 @@ int enunciado(Tokens *tokens, Pila *scopes)
  * 
  * Método para revisar si una asignación está correcta
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  * @return int Si esta todo correcto
  */
 //<Asignacion> -> VARIABLE = <Expresion>
-int asignacion(Tokens *tokens, Pila *scopes)
+int asignacion(Contexto* ctx, Tokens *tokens, Pila *scopes)
 {
 	Nodo* temp = tokens->actual->prev;
 
@@ -303,12 +323,12 @@ int asignacion(Tokens *tokens, Pila *scopes)
 	if(!strcmp(tokens->actual->token->tipoToken,"IGUAL"))
 	{
 		if(!strcmp(token->tipoToken,"LISTA")){
-			printf("Se esperaba un indice valido de la lista\n");
-			term(tokens,scopes);
+			errorCompilacion(ctx,"Se esperaba un indice valido de la lista");
+			term(ctx,tokens,scopes);
 		}
 		borrarValor(scopes,temp->token->cadena);
 		tokens->actual = tokens->actual->next;
-		if(expresion(tokens,scopes,temp->token->cadena)) //AQUI PODRIA PONER LOS VALORES
+		if(expresion(ctx,tokens,scopes,temp->token->cadena)) //AQUI PODRIA PONER LOS VALORES
 			return 1;
 		else if(!strcmp(tokens->actual->token->tipoToken,"PROMO"))
 		{
@@ -316,12 +336,12 @@ int asignacion(Tokens *tokens, Pila *scopes)
 			return 1;
 		}
 	}
-	else if(lista(tokens,scopes))
+	else if(lista(ctx,tokens,scopes))
 	{
 		if(!strcmp(tokens->actual->token->tipoToken,"IGUAL"))
 		{
 			tokens->actual = tokens->actual->next;
-			if(expresionLista(tokens,scopes,temp->token->cadena))
+			if(expresionLista(ctx,tokens,scopes,temp->token->cadena))
 				return 1;
 			else if(!strcmp(tokens->actual->token->tipoToken,"PROMO"))
 			{
@@ -329,34 +349,39 @@ int asignacion(Tokens *tokens, Pila *scopes)
 				return 1;
 			}
 			else{
-				printf("Se esperaba una expresion o \"promo\", se encontro: %s\n",tokens->actual->token->cadena);
-				term(tokens,scopes);
+				errorCompilacion(ctx,"Se esperaba una expresion o \"promo\", se encontro: %s",tokens->actual->token->cadena);
+				term(ctx,tokens,scopes);
 			}
 		}
 		else {
-			printf("Se esperaba \"=\", se encontro: %s\n",tokens->actual->token->cadena);
-			term(tokens,scopes);
+			errorCompilacion(ctx,"Se esperaba \"=\", se encontro: %s",tokens->actual->token->cadena);
+			term(ctx,tokens,scopes);
 		}
 	}
+	else if(!strcmp(tokens->actual->token->tipoToken,"OPASIGNACION"))
+	{
+		if(operarLista(ctx,tokens,scopes))
+			return 1;
+	}
 	else if(!strcmp(token->tipoToken,"LISTA"))
 	{
 		if(!strcmp(tokens->actual->token->tipoToken,"FIN-ANUNCIAR"))
 		{
 			tokens->actual = tokens->actual->next;
-			if(expresionLista(tokens,scopes,temp->token->cadena))
+			if(expresionLista(ctx,tokens,scopes,temp->token->cadena))
 				return 1;
-			else if(!strcmp(tokens->actual->token->tipoToken,"PROMO"))
+			else if(!strcmp(tokens->actual->token->tipoToken,"PROMO") || !strcmp(tokens->actual->token->tipoToken,"PROMOS"))
 			{
 				tokens->actual = tokens->actual->next;
 				return 1;
 			}
 		}
-		printf("Se esperaba \"<-\", se encontro: %s\n", tokens->actual->token->cadena);
-		term(tokens,scopes);
+		errorCompilacion(ctx,"Se esperaba \"<-\", se encontro: %s", tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
 	}
 	else {
-		printf("Se esperaba \"=\" o \"[\", se encontro: %s\n",tokens->actual->token->cadena);
-		term(tokens,scopes);
+		errorCompilacion(ctx,"Se esperaba \"=\" o \"[\", se encontro: %s",tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
 	}
 	
 	return 0;
@@ -367,18 +392,19 @@ int asignacion(Tokens *tokens, Pila *scopes)
  * 
  * Método que revisa si mi token anterior es del tipo lista con indice
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  * @return int Si mi token es una lista con indice
  */
-int lista(Tokens *tokens, Pila *scopes)
+int lista(Contexto* ctx, Tokens *tokens, Pila *scopes)
 {
 	Nodo *prev = tokens->actual;
 	if(!strcmp(tokens->actual->token->tipoToken,"LBRACKET"))
 	{
 		tokens->actual = tokens->actual->next;
-		if(valor(tokens,scopes,tokens->actual->token->cadena))
+		if(valor(ctx,tokens,scopes,tokens->actual->token->cadena))
 		{
 			if(!strcmp(tokens->actual->token->tipoToken,"RBRACKET"))
 			{
@@ -387,13 +413,13 @@ int lista(Tokens *tokens, Pila *scopes)
 			}
 			else
 			{
-				printf("Se esperaba \"]\", se encontro: %s\n",tokens->actual->token->cadena);
-				term(tokens,scopes);
+				errorCompilacion(ctx,"Se esperaba \"]\", se encontro: %s",tokens->actual->token->cadena);
+				term(ctx,tokens,scopes);
 			}
 		}
 		else {
-			printf("Se esperaba un valor valido, se encontro: %s\n",tokens->actual->token->cadena);
-			term(tokens,scopes);
+			errorCompilacion(ctx,"Se esperaba un valor valido, se encontro: %s",tokens->actual->token->cadena);
+			term(ctx,tokens,scopes);
 		}
 	}
 	
@@ -406,6 +432,7 @@ int lista(Tokens *tokens, Pila *scopes)
  * 
  * Analiza si se encontro una expresion correcta
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * @param nombreVar Nombre de la variable para asignarle el valor en la tabla de simbolos
@@ -414,10 +441,10 @@ int lista(Tokens *tokens, Pila *scopes)
  */
 
 //<Expresion> -> <Valor> <OPAritmetico> <Expresion> | <Valor> | CADENA
-int expresion(Tokens *tokens, Pila *scopes,char *nombreVar) //Le debo pasar el nombre de la variable
+int expresion(Contexto* ctx, Tokens *tokens, Pila *scopes,char *nombreVar) //Le debo pasar el nombre de la variable
 {
 	Nodo* prev = tokens->actual;
-	if(valor(tokens,scopes,nombreVar))
+	if(valor(ctx,tokens,scopes,nombreVar))
 	{
 		if(!strcmp(tokens->actual->token->tipoToken,"OPARITMETICO"))
 		{
@@ -432,19 +459,19 @@ int expresion(Tokens *tokens, Pila *scopes,char *nombreVar) //Le debo pasar el n
 			asignarValor(scopes,nombreVar,*tokens->actual->token);
 
 			tokens->actual = tokens->actual->next;
-			if(expresion(tokens,scopes,nombreVar))
+			if(expresion(ctx,tokens,scopes,nombreVar))
 				return 1;
 			else
 			{
-				printf("Se esperaba una expresion, se encontro: %s\n",tokens->actual->token->cadena);
-				term(tokens,scopes);
+				errorCompilacion(ctx,"Se esperaba una expresion, se encontro: %s",tokens->actual->token->cadena);
+				term(ctx,tokens,scopes);
 			}
 		}
 	}
 	
 	tokens->actual = prev;
 
-	if(valor(tokens,scopes,nombreVar))
+	if(valor(ctx,tokens,scopes,nombreVar))
 	{
 		if(!strcmp(tokens->actual->prev->token->tipoToken,"VARIABLE"))
 		{
@@ -475,33 +502,34 @@ int expresion(Tokens *tokens, Pila *scopes,char *nombreVar) //Le debo pasar el n
  * 
  * Analiza si se encontro una expresion correcta para una lista
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * @param nombreVar Nombre de la variable para asignarle el valor en la tabla de simbolos
  * 
  * @return int Si esta todo correcto
  */
-int expresionLista(Tokens *tokens, Pila *scopes,char* nombreVar)
+int expresionLista(Contexto* ctx, Tokens *tokens, Pila *scopes,char* nombreVar)
 {
 	Nodo* prev = tokens->actual;
-	if(valor(tokens,scopes,nombreVar))
+	if(valor(ctx,tokens,scopes,nombreVar))
 	{
 		if(!strcmp(tokens->actual->token->tipoToken,"OPARITMETICO"))
 		{
 			tokens->actual = tokens->actual->next;
-			if(expresion(tokens,scopes,nombreVar))
+			if(expresion(ctx,tokens,scopes,nombreVar))
 				return 1;
 			else
 			{
-				printf("Se esperaba una expresion, se encontro: %s\n",tokens->actual->token->cadena);
-				term(tokens,scopes);
+				errorCompilacion(ctx,"Se esperaba una expresion, se encontro: %s",tokens->actual->token->cadena);
+				term(ctx,tokens,scopes);
 			}
 		}
 	}
 	
 	tokens->actual = prev;
 
-	if(valor(tokens,scopes,nombreVar))
+	if(valor(ctx,tokens,scopes,nombreVar))
 	{
 		return 1;
 	}
@@ -513,27 +541,38 @@ int expresionLista(Tokens *tokens, Pila *scopes,char* nombreVar)
  * 
  * Analiza si encontro un enunciado anunciar y si está correcta su implementación
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  * @return int Si esta todo correcto
  */
-//<Anunciar> -> -> CADENA <- | -> <Variables> <-
-int anunciar(Tokens *tokens, Pila *scopes)
+//<Anunciar> -> -> CADENA <- | -> <Variables> <- | -> VARIABLE CADENA <-
+int anunciar(Contexto* ctx, Tokens *tokens, Pila *scopes)
 {
 	if(!strcmp(tokens->actual->token->tipoToken,"INICIO-ANUNCIAR"))
 	{
 		tokens->actual = tokens->actual->next;
-		if(!strcmp(tokens->actual->token->tipoToken,"STRING"))
+		if(!strcmp(tokens->actual->token->tipoToken,"VARIABLE") && !strcmp(tokens->actual->next->token->tipoToken,"STRING"))
+		{
+			Token* token = regresarValor(scopes,tokens->actual->token->cadena);
+			if(!token || strcmp(token->tipoToken,"LISTA"))
+			{
+				errorCompilacion(ctx,"Solo las listas se anuncian con separador, se encontro: %s",tokens->actual->token->cadena);
+				term(ctx,tokens,scopes);
+			}
+			tokens->actual = tokens->actual->next->next;
+		}
+		else if(!strcmp(tokens->actual->token->tipoToken,"STRING"))
 		{
 			tokens->actual = tokens->actual->next;
 		}
-		else if(expresion(tokens,scopes,tokens->actual->token->cadena))
+		else if(expresion(ctx,tokens,scopes,tokens->actual->token->cadena))
 		{
 			//tokens->actual = tokens->actual->next;
 			//while(variables(tokens));
 		}
-		else if(variables(tokens,scopes))
+		else if(variables(ctx,tokens,scopes))
 		{
 		}
 
@@ -545,16 +584,182 @@ int anunciar(Tokens *tokens, Pila *scopes)
 		}
 		else
 		{
-			printf("Se esperaba \"<-\", se encontro: %s\n",tokens->actual->token->cadena);
-			term(tokens,scopes);
+			errorCompilacion(ctx,"Se esperaba \"<-\", se encontro: %s",tokens->actual->token->cadena);
+			term(ctx,tokens,scopes);
 		}
 
 	} else
 	{
-		printf("Se esperaba \"->\", se encontro: %s\n",tokens->actual->token->cadena);
-		term(tokens,scopes);
+		errorCompilacion(ctx,"Se esperaba \"->\", se encontro: %s",tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Ordenar
+ * 
+ * Analiza si el enunciado ordenar recibe una lista declarada
+ * 
+ * @param ctx Contexto de la compilacion
+ * @param tokens Lista de tokens
+ * @param scopes Tabla de símbolos
+ * 
+ * @return int Si esta todo correcto
+ */
+//<Ordenar> -> ordenar VARIABLE
+int ordenar(Contexto* ctx, Tokens *tokens, Pila *scopes)
+{
+	if(!strcmp(tokens->actual->token->tipoToken,"VARIABLE"))
+	{
+		Token* token = regresarValor(scopes,tokens->actual->token->cadena);
+		if(token && !strcmp(token->tipoToken,"LISTA"))
+		{
+			tokens->actual = tokens->actual->next;
+			return 1;
+		}
+
+		errorCompilacion(ctx,"Solo se pueden ordenar listas, se encontro: %s",tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
+	}
+	else
+	{
+		errorCompilacion(ctx,"Se esperaba una lista, se encontro: %s",tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Archivo lista
+ * 
+ * Analiza si guardar o cargar recibe una lista declarada y el nombre del archivo
+ * 
+ * @param ctx Contexto de la compilacion
+ * @param tokens Lista de tokens
+ * @param scopes Tabla de símbolos
+ * 
+ * @return int Si esta todo correcto
+ */
+//<ArchivoLista> -> guardar VARIABLE CADENA | cargar VARIABLE CADENA
+int archivoLista(Contexto* ctx, Tokens *tokens, Pila *scopes)
+{
+	if(!strcmp(tokens->actual->token->tipoToken,"VARIABLE"))
+	{
+		Token* token = regresarValor(scopes,tokens->actual->token->cadena);
+		if(!token || strcmp(token->tipoToken,"LISTA"))
+		{
+			errorCompilacion(ctx,"Solo se pueden guardar y cargar listas, se encontro: %s",tokens->actual->token->cadena);
+			term(ctx,tokens,scopes);
+		}
+		tokens->actual = tokens->actual->next;
+
+		if(!strcmp(tokens->actual->token->tipoToken,"STRING"))
+		{
+			tokens->actual = tokens->actual->next;
+			return 1;
+		}
+
+		errorCompilacion(ctx,"Se esperaba el nombre del archivo, se encontro: %s",tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
+	}
+	else
+	{
+		errorCompilacion(ctx,"Se esperaba una lista, se encontro: %s",tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Operar lista
+ * 
+ * Analiza si la operacion con todos los elementos de una lista está correcta
+ * 
+ * @param ctx Contexto de la compilacion
+ * @param tokens Lista de tokens
+ * @param scopes Tabla de símbolos
+ * 
+ * @return int Si esta todo correcto
+ */
+//<OperarLista> -> VARIABLE += <Expresion> | VARIABLE -= <Expresion> | VARIABLE *= <Expresion> | VARIABLE /= <Expresion>
+int operarLista(Contexto* ctx, Tokens *tokens, Pila *scopes)
+{
+	Token* token = regresarValor(scopes,tokens->actual->prev->token->cadena);
+
+	if(!token || strcmp(token->tipoToken,"LISTA"))
+	{
+		errorCompilacion(ctx,"Solo se puede usar %s con listas, se encontro: %s",tokens->actual->token->cadena,tokens->actual->prev->token->cadena);
+		term(ctx,tokens,scopes);
 	}
 
+	if(!strcmp(tokens->actual->token->cadena,"%="))
+	{
+		errorCompilacion(ctx,"Operador no permitido para listas: %s",tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
+	}
+
+	tokens->actual = tokens->actual->next;
+	if(expresion(ctx,tokens,scopes,tokens->actual->prev->prev->token->cadena))
+		return 1;
+
+	errorCompilacion(ctx,"Se esperaba una expresion, se encontro: %s",tokens->actual->token->cadena);
+	term(ctx,tokens,scopes);
+	return 0;
+}
+
+/**
+ * @brief Es lista
+ * 
+ * Revisa si el token anterior al actual es una lista declarada
+ * 
+ * @param tokens Lista de tokens
+ * @param scopes Tabla de símbolos
+ * 
+ * @return int Si es una lista
+ */
+int esLista(Tokens *tokens, Pila *scopes)
+{
+	if(strcmp(tokens->actual->prev->token->tipoToken,"VARIABLE"))
+		return 0;
+
+	Token* token = regresarValor(scopes,tokens->actual->prev->token->cadena);
+	return token && !strcmp(token->tipoToken,"LISTA");
+}
+
+/**
+ * @brief Revisar variable
+ * 
+ * Declara la variable del token actual si se esta en una declaracion, o revisa que ya
+ * este declarada si no. Si algo esta mal reporta el error y termina el parser.
+ * 
+ * @param ctx Contexto de la compilacion
+ * @param tokens Lista de tokens
+ * @param scopes Tabla de símbolos
+ * 
+ * @return int Si esta todo correcto
+ */
+int revisarVariable(Contexto* ctx, Tokens *tokens, Pila *scopes)
+{
+	char* nombre = tokens->actual->token->cadena;
+
+	if(ctx->declaracion == 2)
+	{
+		if(declararLista(scopes->head->scope,nombre))
+			return 1;
+		errorCompilacion(ctx,"Lista ya declarada: %s",nombre);
+	}
+	else if(intermedia(scopes,nombre,*tokens->actual->token,ctx->declaracion))
+		return 1;
+	else if(ctx->declaracion == 1)
+		errorCompilacion(ctx,"Variable ya declarada: %s",nombre);
+	else
+		errorCompilacion(ctx,"La variable %s no está declarada en este scope",nombre);
+
+	term(ctx,tokens,scopes);
 	return 0;
 }
 
@@ -563,45 +768,46 @@ int anunciar(Tokens *tokens, Pila *scopes)
  * 
  * Analiza si encontro un enunciado si y si está implementado correctamente
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  * @return int Si esta todo correcto
  */
 //<Si> -> jeff <Comparacion> <Enunciados> hardy | jeff <Comparacion> <Enunciados> matt <Enunciados> hardy
-int si(Tokens *tokens, Pila *scopes)
+int si(Contexto* ctx, Tokens *tokens, Pila *scopes)
 {
 	Nodo *prev = tokens->actual;
 		
-	if(comparacion(tokens,scopes))
+	if(comparacion(ctx,tokens,scopes))
 	{
-		if(enunciados(tokens,scopes))
+		if(enunciados(ctx,tokens,scopes))
 		{
 		}
 
 		if(!strcmp(tokens->actual->token->tipoToken,"SINO"))
 		{
 			tokens->actual = tokens->actual->next;
-			if(enunciados(tokens,scopes)){}
+			if(enunciados(ctx,tokens,scopes)){}
 		}
 
 		if(!strcmp(tokens->actual->token->tipoToken,"FIN-SI"))
 		{
-			push(&copia,scopes->head->scope);
+			push(&ctx->copia,scopes->head->scope);
 			pop(scopes);
 			tokens->actual = tokens->actual->next;
 			return 1;
 		}
 		else
 		{
-			printf("Se esperaba \"hardy\", se encontro: %s\n",tokens->actual->token->cadena);
-			term(tokens,scopes);
+			errorCompilacion(ctx,"Se esperaba \"hardy\", se encontro: %s",tokens->actual->token->cadena);
+			term(ctx,tokens,scopes);
 		}
 	}
 	else
 	{
-		printf("Se esperaba una comparacion, se encontro: %s\n",tokens->actual->token->cadena);
-		term(tokens,scopes);
+		errorCompilacion(ctx,"Se esperaba una comparacion, se encontro: %s",tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
 	}
 
 	return 0;
@@ -612,37 +818,38 @@ int si(Tokens *tokens, Pila *scopes)
  * 
  * Analiza si encontro un enunciado mientras y si está implementado correctamente
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  * @return int Si esta todo correcto
  */
 //<Mientras> -> randy <Comparacion> <Enunciados> orton
-int mientras(Tokens *tokens, Pila *scopes)
+int mientras(Contexto* ctx, Tokens *tokens, Pila *scopes)
 {
-	if(comparacion(tokens,scopes))
+	if(comparacion(ctx,tokens,scopes))
 	{
-		if(enunciados(tokens,scopes))
+		if(enunciados(ctx,tokens,scopes))
 		{
 		}
 
 		if(!strcmp(tokens->actual->token->tipoToken,"FIN-MIENTRAS"))
 		{
-			push(&copia,scopes->head->scope);
+			push(&ctx->copia,scopes->head->scope);
 			pop(scopes);
 			tokens->actual = tokens->actual->next;
 			return 1;
 		}
 		else
 		{
-			printf("Se esperaba \"orton\", se encontro: %s\n",tokens->actual->token->cadena);
-			term(tokens,scopes);
+			errorCompilacion(ctx,"Se esperaba \"orton\", se encontro: %s",tokens->actual->token->cadena);
+			term(ctx,tokens,scopes);
 		}
 	}
 	else
 	{
-		printf("Se esperaba una comparacion, se encontro: %s\n",tokens->actual->token->cadena);
-		term(tokens,scopes);
+		errorCompilacion(ctx,"Se esperaba una comparacion, se encontro: %s",tokens->actual->token->cadena);
+		term(ctx,tokens,scopes);
 	}
 
 	return 0;
@@ -651,35 +858,27 @@ int mientras(Tokens *tokens, Pila *scopes)
 /**
  * @brief Variables
  * 
- * Analiza la variable o variables, depende la variable global declaracion, las va a declarar en la tabla de simbolos
+ * Analiza la variable o variables, depende de la declaracion del contexto, las va a declarar en la tabla de simbolos
  * o buscará si está inicializada antes de usarla.
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  * @return int Si esta todo correcto
  */
 //<Variables> -> VARIABLE <Variables> | VARIABLE
-int variables(Tokens *tokens, Pila *scopes)
+int variables(Contexto* ctx, Tokens *tokens, Pila *scopes)
 {
 	if(!strcmp(tokens->actual->token->tipoToken,"VARIABLE")) //AQUI SE METERA CADA VARIABLE A LA HASHTABLE
 	{
-		if(declaracion == 2)
-		{
-			if(!declararLista(scopes->head->scope,tokens->actual->token->cadena))
-				term(tokens,scopes);
-		}
-		else
-		{
-			if(!intermedia(scopes,tokens->actual->token->cadena,*tokens->actual->token,declaracion))
-				term(tokens,scopes);
-		}
+		revisarVariable(ctx,tokens,scopes);
 		
 		tokens->actual = tokens->actual->next;
 
-		if(variables(tokens,scopes))
+		if(variables(ctx,tokens,scopes))
 		{
-			while(variables(tokens,scopes));
+			while(variables(ctx,tokens,scopes));
 		}
 
 		return 1;
@@ -693,21 +892,22 @@ int variables(Tokens *tokens, Pila *scopes)
  * 
  * Analiza si la comparacion realizada está correctamente implementada
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  * @return int Si esta todo correcto
  */
 //<Comparacion> -> <Valor> <OPRelacional> <Valor>
-int comparacion(Tokens *tokens, Pila *scopes)
+int comparacion(Contexto* ctx, Tokens *tokens, Pila *scopes)
 {
 	Nodo *prev = tokens->actual;
 
-	if(valor(tokens,scopes," "))
+	if(valor(ctx,tokens,scopes," "))
 	{
 		if(oprelacional(tokens,scopes))
 		{
-			if(valor(tokens,scopes," "))
+			if(valor(ctx,tokens,scopes," "))
 				return 1;
 		}
 	}
@@ -720,6 +920,7 @@ int comparacion(Tokens *tokens, Pila *scopes)
  * 
  * Analiza el tipo de valor que es el token actual
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * @param nombreVar Nombre de la variable a buscar
@@ -727,18 +928,17 @@ int comparacion(Tokens *tokens, Pila *scopes)
  * @return int Si esta todo correcto
  */
 //<Valor> -> VARIABLE | NUMERO
-int valor(Tokens* tokens, Pila *scopes, char *nombreVar)
+int valor(Contexto* ctx, Tokens* tokens, Pila *scopes, char *nombreVar)
 {
 	Nodo *prev = tokens->actual;
 
 	if(!strcmp(tokens->actual->token->tipoToken,"VARIABLE"))
 	{
-		if(!intermedia(scopes,tokens->actual->token->cadena,*tokens->actual->token,declaracion))
-			term(tokens,scopes);
+		revisarVariable(ctx,tokens,scopes);
 
 		tokens->actual = tokens->actual->next;
 
-		if(lista(tokens,scopes))
+		if(lista(ctx,tokens,scopes))
 			return 1;
 
 		if(!strcmp(tokens->actual->token->tipoToken,"LAST"))
@@ -758,6 +958,43 @@ int valor(Tokens* tokens, Pila *scopes, char *nombreVar)
 			tokens->actual = tokens->actual->next;
 			return 1;
 		}
+
+		if(!strcmp(tokens->actual->token->tipoToken,"SUM") || !strcmp(tokens->actual->token->tipoToken,"MIN")
+			|| !strcmp(tokens->actual->token->tipoToken,"MAX"))
+		{
+			if(!esLista(tokens,scopes))
+			{
+				errorCompilacion(ctx,"Solo las listas tienen %s, se encontro: %s",tokens->actual->token->cadena,tokens->actual->prev->token->cadena);
+				term(ctx,tokens,scopes);
+			}
+			tokens->actual = tokens->actual->next;
+			return 1;
+		}
+
+		//Producto punto: VARIABLE .p [ VARIABLE ]
+		if(!strcmp(tokens->actual->token->tipoToken,"DOT"))
+		{
+			if(!esLista(tokens,scopes))
+			{
+				errorCompilacion(ctx,"Solo las listas tienen .p, se encontro: %s",tokens->actual->prev->token->cadena);
+				term(ctx,tokens,scopes);
+			}
+			tokens->actual = tokens->actual->next;
+			if(strcmp(tokens->actual->token->tipoToken,"LBRACKET") || strcmp(tokens->actual->next->token->tipoToken,"VARIABLE")
+				|| strcmp(tokens->actual->next->next->token->tipoToken,"RBRACKET"))
+			{
+				errorCompilacion(ctx,"Se esperaba \"[lista]\" despues de .p, se encontro: %s",tokens->actual->token->cadena);
+				term(ctx,tokens,scopes);
+			}
+			tokens->actual = tokens->actual->next->next;
+			if(!esLista(tokens,scopes))
+			{
+				errorCompilacion(ctx,"Solo se puede hacer producto punto con listas, se encontro: %s",tokens->actual->prev->token->cadena);
+				term(ctx,tokens,scopes);
+			}
+			tokens->actual = tokens->actual->next;
+			return 1;
+		}
 		return 1;
 	}
 	
@@ -813,21 +1050,26 @@ int oprelacional(Tokens *tokens, Pila *scopes)
 /**
  * @brief Terminacion de programa ante un error
  * 
- * Método que borra todo para no dejar fugas de memoria, imprime en que línea se encontró el error y termina el programa.
+ * Método que pasa el scope actual a la copia y borra los demas para no dejar fugas de memoria,
+ * guarda e imprime en que línea y columna se encontró el error con la posición del token actual y
+ * regresa al parser, que termina la compilacion de este archivo.
  * 
+ * @param ctx Contexto de la compilacion
  * @param tokens Lista de tokens
  * @param scopes Tabla de símbolos
  * 
  */
-void term(Tokens *tokens, Pila *scopes)
+void term(Contexto* ctx, Tokens *tokens, Pila *scopes)
 {
-	push(&copia,scopes->head->scope);
+	Nodo *error = tokens->actual ? tokens->actual : tokens->fin;
+	ctx->lineaError = error ? error->token->linea : 0;
+	ctx->columnaError = error ? error->token->columna : 0;
+
+	push(&ctx->copia,scopes->head->scope);
 	pop(scopes);
-	borrarLista(tokens);
 	vaciarPilaCompleto(scopes);
-	vaciarPilaCompleto(&copia);
-	printf("Error en lína %d\n",linea);
-	exit(1);
+	errorCompilacion(ctx,"Error en línea %d, columna %d",ctx->lineaError,ctx->columnaError);
+	longjmp(ctx->error,1);
 }
 
 /**
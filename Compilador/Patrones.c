@@ -0,0 +1,508 @@
+/**
+ * @file Patrones.c
+ * @brief Implementación del reconocimiento de patrones escritos a mano.
+ *
+ * Busca el ordenamiento burbuja escrito con dos randy (como el de sort.wwe)
+ * y lo cambia por un enunciado ordenar parcial sobre la misma cantidad de elementos.
+ * Se hace antes de las demas optimizaciones, sobre los enunciados tal como se escribieron.
+ * Solo se cambia si las variables del ciclo ya no se leen despues, porque el
+ * enunciado ordenar no les deja el valor final que dejaban los ciclos.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include "Patrones.h"
+
+/**@cond */
+Expresion* asignacionDe(Enunciado* e, char* nombre);
+Enunciado* saltarDeclaracion(Enunciado* e, char** declarada);
+Enunciado* definicionPrevia(Programa* bloque, Enunciado* ciclo, char* nombre);
+Expresion* restaDe(Expresion* expr, Valor val);
+int modificaEnunciado(Enunciado* e, char* nombre);
+int esIndice(Valor val, char* lista, char* var);
+int mismoValor(Valor a, Valor b);
+/**@endcond */
+
+/**
+ * @brief Reconocer ordenamientos
+ * @ingroup funciones_patrones
+ *
+ * Recorre un bloque y sus bloques internos, y cada ciclo que sea un ordenamiento
+ * burbuja lo cambia en su lugar por un enunciado ordenar.
+ *
+ * @param bloque Bloque a recorrer
+ * @param principal Booleano para saber si es el bloque principal del programa
+ */
+void reconocerOrdenamientos(Programa* bloque, int principal)
+{
+    if(!bloque)
+        return;
+
+    Enunciado* anterior = NULL;
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; anterior = e, e = e->siguiente)
+    {
+        Valor* cantidad = NULL;
+        char* lista = NULL;
+
+        if(e->tipo == ENUNC_MIENTRAS && esBurbuja(bloque,e,principal,&cantidad,&lista))
+        {
+            Enunciado* nuevo = (Enunciado*)calloc(1,sizeof(Enunciado));
+            nuevo->tipo = ENUNC_ORDENAR;
+            nuevo->ordenar.lista = strdup(lista);
+            nuevo->ordenar.parcial = 1;
+            nuevo->ordenar.hasta = copiarValor(*cantidad);
+            nuevo->linea = e->linea;
+            nuevo->columna = e->columna;
+
+            nuevo->siguiente = e->siguiente;
+            if(anterior)
+                anterior->siguiente = nuevo;
+            else
+                bloque->lista_enunciados = nuevo;
+            if(bloque->ultimo_enunciado == e)
+                bloque->ultimo_enunciado = nuevo;
+
+            //Se libera el ciclo viejo como un programa de un solo enunciado
+            Programa viejo = {0};
+            e->siguiente = NULL;
+            viejo.lista_enunciados = e;
+            eliminarPrograma(&viejo);
+
+            e = nuevo;
+            continue;
+        }
+
+        switch(e->tipo)
+        {
+            case ENUNC_SI:
+                reconocerOrdenamientos(e->si.entonces,0);
+                reconocerOrdenamientos(e->si.si_no,0);
+                break;
+            case ENUNC_MIENTRAS:
+                reconocerOrdenamientos(e->mientras.cuerpo,0);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Es burbuja
+ * @ingroup funciones_patrones
+ *
+ * Revisa si el ciclo es exactamente el ordenamiento burbuja:
+ *
+ *     i = 0
+ *     lim = N - 1
+ *     randy i < lim
+ *         [nxt Y]
+ *         j = 0
+ *         Y = N - i - 1
+ *         randy j < Y
+ *             [nxt K]
+ *             K = j + 1
+ *             jeff L[j] > L[K]
+ *                 [nxt T]
+ *                 T = L[j]
+ *                 L[j] = L[K]
+ *                 L[K] = T
+ *             hardy
+ *             j = j + 1
+ *         orton
+ *         i = i + 1
+ *     orton
+ *
+ * Con N un numero o una variable, todos los nombres distintos y ninguna de las
+ * variables del ciclo leida despues de el. Ese ciclo deja ordenados los primeros
+ * techo(N) elementos de L con los mismos intercambios que un ordenamiento estable.
+ *
+ * @param bloque Bloque donde esta el ciclo
+ * @param ciclo Enunciado del tipo mientras a revisar
+ * @param principal Booleano para saber si el bloque es el principal
+ * @param cantidad Donde se guarda el valor N
+ * @param lista Donde se guarda el nombre de la lista L
+ *
+ * @return int Si el ciclo es un ordenamiento burbuja
+ */
+int esBurbuja(Programa* bloque, Enunciado* ciclo, int principal, Valor** cantidad, char** lista)
+{
+    Comparacion afuera = ciclo->mientras.comp;
+    if(afuera.operador != OP_MENOR || afuera.izquierda.tipo != VAL_VARIABLE || afuera.derecha.tipo != VAL_VARIABLE)
+        return 0;
+    char* i = afuera.izquierda.nombre;
+    char* lim = afuera.derecha.nombre;
+
+    //Cuerpo de afuera: [nxt Y], j = 0 y Y = N - i - 1 en cualquier orden, el ciclo de adentro, i = i + 1
+    char* declaradaY = NULL;
+    Enunciado* primero = saltarDeclaracion(ciclo->mientras.cuerpo->lista_enunciados,&declaradaY);
+    if(!primero || !primero->siguiente)
+        return 0;
+    Enunciado* segundo = primero->siguiente;
+    Enunciado* adentro = segundo->siguiente;
+    if(!adentro || adentro->tipo != ENUNC_MIENTRAS || !adentro->siguiente || adentro->siguiente->siguiente)
+        return 0;
+    Enunciado* incrementoI = adentro->siguiente;
+
+    Comparacion comp = adentro->mientras.comp;
+    if(comp.operador != OP_MENOR || comp.izquierda.tipo != VAL_VARIABLE || comp.derecha.tipo != VAL_VARIABLE)
+        return 0;
+    char* j = comp.izquierda.nombre;
+    char* y = comp.derecha.nombre;
+    if(declaradaY && strcmp(declaradaY,y))
+        return 0;
+
+    Expresion* ceroJ = asignacionDe(primero,j);
+    Expresion* limiteY = asignacionDe(segundo,y);
+    if(!ceroJ || !limiteY)
+    {
+        ceroJ = asignacionDe(segundo,j);
+        limiteY = asignacionDe(primero,y);
+    }
+    if(!ceroJ || !limiteY || ceroJ->tipo != EXPR_VALOR || ceroJ->valor.tipo != VAL_NUMERO || ceroJ->valor.numero != 0)
+        return 0;
+
+    if(limiteY->tipo != EXPR_BINARIA || limiteY->binaria.izquierda->tipo != EXPR_VALOR)
+        return 0;
+    Valor* n = &limiteY->binaria.izquierda->valor;
+    if(n->tipo != VAL_VARIABLE && n->tipo != VAL_NUMERO)
+        return 0;
+    Expresion* resto = restaDe(limiteY,*n);
+    if(!resto || pasoAsignacion(resto,i) != -1)
+        return 0;
+
+    Expresion* paso = asignacionDe(incrementoI,i);
+    if(!paso || pasoAsignacion(paso,i) != 1)
+        return 0;
+
+    //Cuerpo de adentro: [nxt K], K = j + 1, el jeff, j = j + 1
+    char* declaradaK = NULL;
+    Enunciado* siguienteK = saltarDeclaracion(adentro->mientras.cuerpo->lista_enunciados,&declaradaK);
+    if(!siguienteK || siguienteK->tipo != ENUNC_ASIGNACION || siguienteK->asignacion.variable.tipo != VAL_VARIABLE)
+        return 0;
+    char* k = siguienteK->asignacion.variable.nombre;
+    if((declaradaK && strcmp(declaradaK,k)) || pasoAsignacion(siguienteK->asignacion.expresion,j) != 1)
+        return 0;
+
+    Enunciado* si = siguienteK->siguiente;
+    if(!si || si->tipo != ENUNC_SI || !si->siguiente || si->siguiente->siguiente)
+        return 0;
+    paso = asignacionDe(si->siguiente,j);
+    if(!paso || pasoAsignacion(paso,j) != 1)
+        return 0;
+    if(si->si.si_no && si->si.si_no->lista_enunciados)
+        return 0;
+
+    //Condicion: L[j] > L[K] o L[K] < L[j]
+    Comparacion cambio = si->si.comp;
+    char* l = cambio.izquierda.nombre;
+    if(cambio.izquierda.tipo != VAL_LISTA_INDEX_VAR)
+        return 0;
+    if(!(cambio.operador == OP_MAYOR && esIndice(cambio.izquierda,l,j) && esIndice(cambio.derecha,l,k))
+        && !(cambio.operador == OP_MENOR && esIndice(cambio.izquierda,l,k) && esIndice(cambio.derecha,l,j)))
+        return 0;
+
+    //Intercambio: [nxt T], T = L[j], L[j] = L[K], L[K] = T
+    char* declaradaT = NULL;
+    Enunciado* guardar = saltarDeclaracion(si->si.entonces->lista_enunciados,&declaradaT);
+    if(!guardar || guardar->tipo != ENUNC_ASIGNACION || guardar->asignacion.variable.tipo != VAL_VARIABLE)
+        return 0;
+    char* t = guardar->asignacion.variable.nombre;
+    Expresion* expr = guardar->asignacion.expresion;
+    if((declaradaT && strcmp(declaradaT,t)) || expr->tipo != EXPR_VALOR || !esIndice(expr->valor,l,j))
+        return 0;
+
+    Enunciado* mover = guardar->siguiente;
+    if(!mover || mover->tipo != ENUNC_ASIGNACION || !esIndice(mover->asignacion.variable,l,j))
+        return 0;
+    expr = mover->asignacion.expresion;
+    if(expr->tipo != EXPR_VALOR || !esIndice(expr->valor,l,k))
+        return 0;
+
+    Enunciado* regresar = mover->siguiente;
+    if(!regresar || regresar->siguiente || regresar->tipo != ENUNC_ASIGNACION || !esIndice(regresar->asignacion.variable,l,k))
+        return 0;
+    expr = regresar->asignacion.expresion;
+    if(expr->tipo != EXPR_VALOR || expr->valor.tipo != VAL_VARIABLE || strcmp(expr->valor.nombre,t))
+        return 0;
+
+    //Todos los nombres deben ser distintos
+    char* nombres[] = {i, lim, j, y, k, t, l, n->tipo == VAL_VARIABLE ? n->nombre : NULL};
+    int total = sizeof(nombres)/sizeof(nombres[0]) - (n->tipo != VAL_VARIABLE);
+    for(int a = 0; a < total; a++)
+        for(int b = a + 1; b < total; b++)
+            if(!strcmp(nombres[a],nombres[b]))
+                return 0;
+
+    //Antes del ciclo: i = 0 y lim = N - 1, sin cambiar N entre lim y el ciclo
+    Enunciado* definicion = definicionPrevia(bloque,ciclo,i);
+    expr = definicion ? asignacionDe(definicion,i) : NULL;
+    if(!expr || expr->tipo != EXPR_VALOR || expr->valor.tipo != VAL_NUMERO || expr->valor.numero != 0)
+        return 0;
+
+    definicion = definicionPrevia(bloque,ciclo,lim);
+    expr = definicion ? asignacionDe(definicion,lim) : NULL;
+    resto = expr ? restaDe(expr,*n) : NULL;
+    if(!resto || resto->tipo != EXPR_VALOR || resto->valor.tipo != VAL_NUMERO || resto->valor.numero != 1)
+        return 0;
+    if(n->tipo == VAL_VARIABLE)
+        for(Enunciado* e = definicion->siguiente; e != ciclo; e = e->siguiente)
+            if(modificaEnunciado(e,n->nombre))
+                return 0;
+
+    //Despues del ciclo no se pueden leer sus variables, las declaradas adentro no existen afuera
+    if(!variableMuerta(bloque,ciclo->siguiente,i,principal) || !variableMuerta(bloque,ciclo->siguiente,j,principal))
+        return 0;
+    if(!declaradaY && !variableMuerta(bloque,ciclo->siguiente,y,principal))
+        return 0;
+    if(!declaradaK && !variableMuerta(bloque,ciclo->siguiente,k,principal))
+        return 0;
+    if(!declaradaT && !variableMuerta(bloque,ciclo->siguiente,t,principal))
+        return 0;
+
+    *cantidad = n;
+    *lista = l;
+    return 1;
+}
+
+/**
+ * @brief Variable muerta
+ * @ingroup funciones_patrones
+ *
+ * Revisa si el valor que tiene la variable en un punto ya no se lee. Esta muerta si lo
+ * siguiente que le pasa es una asignacion que no la lee, leerla del teclado o declararla
+ * de nuevo, o si se llega al final del programa o de un bloque que la declara.
+ *
+ * @param bloque Bloque donde esta el punto
+ * @param desde Primer enunciado despues del punto
+ * @param nombre Variable a revisar
+ * @param principal Booleano para saber si el bloque es el principal
+ *
+ * @return int Si la variable esta muerta
+ */
+int variableMuerta(Programa* bloque, Enunciado* desde, char* nombre, int principal)
+{
+    for(Enunciado* e = desde; e != NULL; e = e->siguiente)
+    {
+        Expresion* expr = asignacionDe(e,nombre);
+        if(expr)
+            return !usaExpresion(expr,nombre);
+
+        if(e->tipo == ENUNC_LEER && !strcmp(e->leer.variable,nombre))
+            return 1;
+
+        if(e->tipo == ENUNC_DECLARACION)
+            for(int i = 0; i < e->declaracion.cantidad; i++)
+                if(!strcmp(e->declaracion.variables[i],nombre))
+                    return 1;
+
+        if(usaEnunciado(e,nombre))
+            return 0;
+    }
+
+    if(principal)
+        return 1;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+        if(e->tipo == ENUNC_DECLARACION)
+            for(int i = 0; i < e->declaracion.cantidad; i++)
+                if(!strcmp(e->declaracion.variables[i],nombre))
+                    return 1;
+
+    return 0;
+}
+
+/**
+ * @brief Usa valor
+ * @ingroup funciones_patrones
+ *
+ * @param val Valor a revisar
+ * @param nombre Variable o lista a buscar
+ *
+ * @return int Si el valor menciona el nombre
+ */
+int usaValor(Valor val, char* nombre)
+{
+    if(val.nombre && !strcmp(val.nombre,nombre))
+        return 1;
+
+    return (val.tipo == VAL_LISTA_INDEX_VAR || val.tipo == VAL_LISTA_P) && val.var && !strcmp(val.var,nombre);
+}
+
+/**
+ * @brief Usa expresion
+ * @ingroup funciones_patrones
+ *
+ * @param expr Expresion a revisar
+ * @param nombre Variable o lista a buscar
+ *
+ * @return int Si algun valor de la expresion menciona el nombre
+ */
+int usaExpresion(Expresion* expr, char* nombre)
+{
+    if(!expr)
+        return 0;
+
+    if(expr->tipo == EXPR_VALOR)
+        return usaValor(expr->valor,nombre);
+
+    return usaExpresion(expr->binaria.izquierda,nombre) || usaExpresion(expr->binaria.derecha,nombre);
+}
+
+/**
+ * @brief Usa bloque
+ * @ingroup funciones_patrones
+ *
+ * @param bloque Bloque a revisar
+ * @param nombre Variable o lista a buscar
+ *
+ * @return int Si algun enunciado del bloque menciona el nombre
+ */
+int usaBloque(Programa* bloque, char* nombre)
+{
+    if(!bloque)
+        return 0;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+        if(usaEnunciado(e,nombre))
+            return 1;
+
+    return 0;
+}
+
+/**
+ * @brief Usa enunciado
+ * @ingroup funciones_patrones
+ *
+ * @param e Enunciado a revisar
+ * @param nombre Variable o lista a buscar
+ *
+ * @return int Si el enunciado o sus bloques internos mencionan el nombre
+ */
+int usaEnunciado(Enunciado* e, char* nombre)
+{
+    switch(e->tipo)
+    {
+        case ENUNC_DECLARACION:
+        case ENUNC_DECLARACION_LISTA:
+            for(int i = 0; i < e->declaracion.cantidad; i++)
+                if(!strcmp(e->declaracion.variables[i],nombre))
+                    return 1;
+            return 0;
+        case ENUNC_ASIGNACION:
+        case ENUNC_ASIGNACION_LISTA:
+            return usaValor(e->asignacion.variable,nombre) || usaExpresion(e->asignacion.expresion,nombre);
+        case ENUNC_LEER:
+        case ENUNC_LEER_LISTA:
+        case ENUNC_LEER_TODO:
+            return !strcmp(e->leer.variable,nombre);
+        case ENUNC_ANUNCIAR:
+            return !e->anunciar.esCadena && usaExpresion(e->anunciar.expresion,nombre);
+        case ENUNC_ANUNCIAR_LISTA:
+            return !strcmp(e->anunciarLista.lista,nombre);
+        case ENUNC_GUARDAR_LISTA:
+        case ENUNC_CARGAR_LISTA:
+            return !strcmp(e->archivo.lista,nombre);
+        case ENUNC_SI:
+            return usaValor(e->si.comp.izquierda,nombre) || usaValor(e->si.comp.derecha,nombre)
+                || usaBloque(e->si.entonces,nombre) || usaBloque(e->si.si_no,nombre);
+        case ENUNC_MIENTRAS:
+            return usaValor(e->mientras.comp.izquierda,nombre) || usaValor(e->mientras.comp.derecha,nombre)
+                || (e->mientras.inductor && !strcmp(e->mientras.inductor,nombre))
+                || usaBloque(e->mientras.previo,nombre) || usaBloque(e->mientras.cuerpo,nombre);
+        case ENUNC_RESERVAR_LISTA:
+            return !strcmp(e->reservar.lista,nombre) || usaValor(e->reservar.desde,nombre) || usaValor(e->reservar.hasta,nombre);
+        case ENUNC_ORDENAR:
+            return !strcmp(e->ordenar.lista,nombre) || (e->ordenar.parcial && usaValor(e->ordenar.hasta,nombre));
+        case ENUNC_OPERAR_LISTA:
+            return !strcmp(e->operar.lista,nombre) || usaExpresion(e->operar.expresion,nombre);
+        default:
+            return 1;
+    }
+}
+
+/**@cond */
+
+/*
+ * Regresa la expresion si el enunciado es nombre = expresion, si no regresa NULL
+ */
+Expresion* asignacionDe(Enunciado* e, char* nombre)
+{
+    if(e && e->tipo == ENUNC_ASIGNACION && e->asignacion.variable.tipo == VAL_VARIABLE
+        && !strcmp(e->asignacion.variable.nombre,nombre))
+        return e->asignacion.expresion;
+
+    return NULL;
+}
+
+/*
+ * Si el enunciado declara una sola variable la guarda y regresa el que sigue
+ */
+Enunciado* saltarDeclaracion(Enunciado* e, char** declarada)
+{
+    *declarada = NULL;
+    if(e && e->tipo == ENUNC_DECLARACION && e->declaracion.cantidad == 1)
+    {
+        *declarada = e->declaracion.variables[0];
+        return e->siguiente;
+    }
+
+    return e;
+}
+
+/*
+ * Ultimo enunciado antes del ciclo, en el mismo bloque, que modifica la variable
+ */
+Enunciado* definicionPrevia(Programa* bloque, Enunciado* ciclo, char* nombre)
+{
+    Enunciado* definicion = NULL;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != ciclo; e = e->siguiente)
+        if(modificaEnunciado(e,nombre))
+            definicion = e;
+
+    return definicion;
+}
+
+/*
+ * Si la expresion es val - resto regresa resto, si no regresa NULL
+ */
+Expresion* restaDe(Expresion* expr, Valor val)
+{
+    if(expr->tipo != EXPR_BINARIA || strcmp(expr->binaria.oparitmetico,"-") || expr->binaria.izquierda->tipo != EXPR_VALOR)
+        return NULL;
+
+    return mismoValor(expr->binaria.izquierda->valor,val) ? expr->binaria.derecha : NULL;
+}
+
+/*
+ * Cuenta las asignaciones de un solo enunciado, se corta la lista mientras se cuentan
+ */
+int modificaEnunciado(Enunciado* e, char* nombre)
+{
+    Enunciado* siguiente = e->siguiente;
+    Programa uno = {0};
+    uno.lista_enunciados = e;
+
+    e->siguiente = NULL;
+    int cantidad = contarAsignaciones(&uno,nombre);
+    e->siguiente = siguiente;
+
+    return cantidad;
+}
+
+int esIndice(Valor val, char* lista, char* var)
+{
+    return val.tipo == VAL_LISTA_INDEX_VAR && !strcmp(val.nombre,lista) && !strcmp(val.var,var);
+}
+
+int mismoValor(Valor a, Valor b)
+{
+    if(a.tipo != b.tipo)
+        return 0;
+    if(a.tipo == VAL_NUMERO)
+        return a.numero == b.numero;
+
+    return a.tipo == VAL_VARIABLE && !strcmp(a.nombre,b.nombre);
+}
+/**@endcond */
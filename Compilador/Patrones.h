@@ -0,0 +1,25 @@
+/**
+ * @file Patrones.h
+ * @brief Prototipos del reconocimiento de patrones escritos a mano.
+ *
+ * Este archivo contiene las funciones que buscan algoritmos conocidos
+ * escritos con ciclos y los cambian por el enunciado equivalente del lenguaje.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+#include "Optimizador.h"
+
+/**
+ * @defgroup funciones_patrones Funciones de reconocimiento de patrones
+ * @{
+ */
+void reconocerOrdenamientos(Programa* bloque, int principal);
+int esBurbuja(Programa* bloque, Enunciado* ciclo, int principal, Valor** cantidad, char** lista);
+int variableMuerta(Programa* bloque, Enunciado* desde, char* nombre, int principal);
+int usaValor(Valor val, char* nombre);
+int usaExpresion(Expresion* expr, char* nombre);
+int usaBloque(Programa* bloque, char* nombre);
+int usaEnunciado(Enunciado* e, char* nombre);
+/** @} */
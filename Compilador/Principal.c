@@ -0,0 +1,201 @@
+/**
+ * @mainpage Compilador-Traductor de Lenguaje WWE
+ * 
+ * Este proyecto implementa un traductor para un lenguaje propio
+ * a c, para despues realizar la compilación y regresar un ejectuable,
+ * funcionando como cualquier compilador
+ * 
+ * ##Contenido principal
+ * -Analis léxico
+ * -Parser/Análisis semántico
+ * -Creación de enunciados
+ * -Traduccion
+ * -Compilacion de archivo y retorno de ejecutable
+ * 
+ * ##Autores
+ * -Alexander Arellano Odabachea
+ * 
+ * @author Alexander Arellano Odabachea
+ */
+/**
+ * @file Principal.c
+ * @brief Programa wwe de la linea de comandos
+ *
+ * Lee los argumentos y compila uno o varios archivos .wwe. Todo lo demas del
+ * compilador esta en la libreria wwec, que no necesita este archivo.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "Contexto.h"
+#include "Lote.h"
+#include "Servidor.h"
+#include "Vigilar.h"
+
+int leerOpciones(int argc, char *argv[], Opciones* opciones, char** archivos, int* cantidad, char** archivo_salida, char** escuchar);
+
+int main(int argc, char *argv[])
+{
+	char** archivos = (char**)calloc(argc,sizeof(char*));
+	int cantidad = 0;
+	char* archivo_salida = NULL;
+	char* escuchar = NULL;
+	Opciones opciones = OPCIONES_DEFECTO;
+	opciones.servidor = getenv("WWE_SERVIDOR");
+
+	if(!leerOpciones(argc,argv,&opciones,archivos,&cantidad,&archivo_salida,&escuchar))
+	{
+		printf("No ingreso el nombre del archivo\n");
+		printf("Uso: wwe programa.wwe -o salida [--numeric float|double|int64] [--checked] [--sort-idioms] [--parallel] [--time-report[=json]] [--profile] [-g] [--connect socket] [--watch]\n");
+		printf("     wwe -j N a.wwe b.wwe ... [-o carpeta] [opciones]\n");
+		printf("     wwe --server socket [-j N]\n");
+		free(archivos);
+		return 0;
+	}
+
+	if(escuchar)
+	{
+		free(archivos);
+		return servidor(escuchar,opciones.hilos);
+	}
+
+	if(opciones.vigilar)
+	{
+		int res = cantidad == 1 ? vigilar(archivos[0],archivo_salida,&opciones) : 1;
+		if(cantidad != 1)
+			printf("--watch solo funciona con un archivo\n");
+		free(archivos);
+		return res;
+	}
+
+	Contexto* contextos = (Contexto*)calloc(cantidad,sizeof(Contexto));
+	int correctos;
+
+	if(cantidad == 1)
+	{
+		inicializarContexto(&contextos[0],archivos[0],archivo_salida,&opciones);
+		correctos = compilar(&contextos[0]);
+	}
+	else
+	{
+		char salida[512];
+		for(int i = 0; i < cantidad; i++)
+		{
+			nombreSalida(salida,sizeof(salida),archivos[i],archivo_salida);
+			inicializarContexto(&contextos[i],archivos[i],salida,&opciones);
+		}
+		correctos = compilarLote(contextos,cantidad,opciones.hilos);
+		printf("Compilados %d de %d archivos\n",correctos,cantidad);
+	}
+
+	for(int i = 0; i < cantidad; i++)
+		liberarContexto(&contextos[i]);
+	free(contextos);
+	free(archivos);
+	return correctos == cantidad ? 0 : 1;
+}
+
+/**
+ * @brief Leer opciones
+ * @ingroup funciones_compilador
+ *
+ * Método que recorre los argumentos del programa y llena las opciones.
+ * Con un archivo .wwe la salida con -o es obligatoria; con varios, -o es la
+ * carpeta donde quedan los ejecutables y es opcional. Con --server no se
+ * necesitan archivos.
+ *
+ * @param argc Cantidad de argumentos
+ * @param argv Argumentos del programa
+ * @param opciones Opciones que se llenan
+ * @param archivos Donde se guardan los nombres de los archivos .wwe, con espacio para argc
+ * @param cantidad Donde se guarda la cantidad de archivos .wwe
+ * @param archivo_salida Donde se guarda el nombre del ejecutable o de la carpeta
+ * @param escuchar Donde se guarda el socket de --server
+ *
+ * @return int Si los argumentos son correctos
+ */
+int leerOpciones(int argc, char *argv[], Opciones* opciones, char** archivos, int* cantidad, char** archivo_salida, char** escuchar)
+{
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strcmp(argv[i],"-o"))
+		{
+			if(++i >= argc)
+				return 0;
+			*archivo_salida = argv[i];
+		}
+		else if(!strncmp(argv[i],"-j",2))
+		{
+			char* hilos = argv[i] + 2;
+			if(!*hilos)
+			{
+				if(++i >= argc)
+					return 0;
+				hilos = argv[i];
+			}
+			opciones->hilos = atoi(hilos);
+			if(opciones->hilos < 1)
+			{
+				printf("Cantidad de hilos incorrecta: %s\n",hilos);
+				return 0;
+			}
+		}
+		else if(!strcmp(argv[i],"--numeric") || !strncmp(argv[i],"--numeric=",10))
+		{
+			char* tipo = argv[i] + 9;
+			if(*tipo == '=')
+				tipo++;
+			else if(++i < argc)
+				tipo = argv[i];
+			else
+				return 0;
+
+			if(!strcmp(tipo,"float"))
+				opciones->numero = NUM_FLOAT;
+			else if(!strcmp(tipo,"double"))
+				opciones->numero = NUM_DOUBLE;
+			else if(!strcmp(tipo,"int64"))
+				opciones->numero = NUM_INT64;
+			else
+			{
+				printf("Tipo numerico desconocido: %s\n",tipo);
+				return 0;
+			}
+		}
+		else if(!strcmp(argv[i],"--checked"))
+			opciones->checked = 1;
+		else if(!strcmp(argv[i],"--sort-idioms"))
+			opciones->ordenamientos = 1;
+		else if(!strcmp(argv[i],"--parallel"))
+			opciones->paralelo = 1;
+		else if(!strcmp(argv[i],"--time-report"))
+			opciones->reporte = REPORTE_TABLA;
+		else if(!strcmp(argv[i],"--time-report=json"))
+			opciones->reporte = REPORTE_JSON;
+		else if(!strcmp(argv[i],"--profile"))
+			opciones->perfil = 1;
+		else if(!strcmp(argv[i],"-g"))
+			opciones->depuracion = 1;
+		else if(!strcmp(argv[i],"--watch"))
+			opciones->vigilar = 1;
+		else if(!strcmp(argv[i],"--server"))
+		{
+			if(++i >= argc)
+				return 0;
+			*escuchar = argv[i];
+		}
+		else if(!strcmp(argv[i],"--connect"))
+		{
+			if(++i >= argc)
+				return 0;
+			opciones->servidor = argv[i];
+		}
+		else if(argv[i][0] != '-')
+			archivos[(*cantidad)++] = argv[i];
+		else
+			return 0;
+	}
+
+	return *escuchar || *cantidad > 1 || (*cantidad == 1 && *archivo_salida);
+}
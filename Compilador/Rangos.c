@@ -0,0 +1,632 @@
+/**
+ * @file Rangos.c
+ * @brief Implementación del analisis de rangos de los indices.
+ *
+ * Recorre los enunciados guardando lo que se sabe de cada variable
+ * (que es mayor o igual a una constante o que es menor que el tamaño
+ * de una lista) y marca como seguros los indices que siempre caen
+ * dentro de la lista, para no revisarlos en el modo --checked.
+ * En modo float se supone que los tamaños de las listas caben exactos
+ * en el flotante (menos de 2^24 elementos).
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include "Rangos.h"
+
+/**@cond */
+void agregarCondicion(Hechos* hechos, Comparacion comp, Programa* cuerpo);
+long techo(double numero);
+/**@endcond */
+
+/**
+ * @brief Analizar rangos
+ * @ingroup funciones_rangos
+ *
+ * Punto de entrada del analisis, se hace despues de todas las optimizaciones
+ * porque necesita los contadores de los ciclos y las variables enteras ya marcadas.
+ *
+ * @param programa Lista de enunciados completa
+ */
+void analizarRangos(Programa* programa)
+{
+    Hechos hechos = {0};
+    rangosBloque(programa,&hechos);
+    liberarHechos(&hechos);
+}
+
+/**
+ * @brief Rangos bloque
+ * @ingroup funciones_rangos
+ *
+ * Recorre el bloque en orden, marcando los indices con los hechos que
+ * se conocen en ese punto y actualizando los hechos con cada enunciado.
+ *
+ * @param bloque Bloque a recorrer
+ * @param hechos Hechos conocidos al inicio del bloque, al final quedan los del final
+ */
+void rangosBloque(Programa* bloque, Hechos* hechos)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_DECLARACION:
+                for(int i = 0; i < e->declaracion.cantidad; i++)
+                    olvidarVariable(hechos,e->declaracion.variables[i]);
+                break;
+            case ENUNC_DECLARACION_LISTA:
+                for(int i = 0; i < e->declaracion.cantidad; i++)
+                    olvidarLista(hechos,e->declaracion.variables[i]);
+                break;
+            case ENUNC_ASIGNACION:
+                marcarIndicesExpresion(e->asignacion.expresion,hechos);
+                marcarIndice(&e->asignacion.variable,hechos);
+                if(e->asignacion.variable.tipo == VAL_VARIABLE)
+                    rangosAsignacion(hechos,e->asignacion.variable.nombre,e->asignacion.expresion);
+                break;
+            case ENUNC_ASIGNACION_LISTA:
+                //Agregar a la lista solo la hace crecer, las cotas siguen siendo validas
+                marcarIndicesExpresion(e->asignacion.expresion,hechos);
+                break;
+            case ENUNC_LEER:
+                olvidarVariable(hechos,e->leer.variable);
+                break;
+            case ENUNC_ANUNCIAR:
+                if(!e->anunciar.esCadena)
+                    marcarIndicesExpresion(e->anunciar.expresion,hechos);
+                break;
+            case ENUNC_OPERAR_LISTA:
+                //Cambia los elementos pero no el tamaño
+                marcarIndicesExpresion(e->operar.expresion,hechos);
+                break;
+            case ENUNC_CARGAR_LISTA:
+                //La lista cargada puede ser mas chica que antes
+                olvidarLista(hechos,e->archivo.lista);
+                break;
+            case ENUNC_SI:
+            {
+                marcarIndice(&e->si.comp.izquierda,hechos);
+                marcarIndice(&e->si.comp.derecha,hechos);
+
+                Hechos rama = {0};
+                copiarHechos(&rama,hechos);
+                agregarCondicion(&rama,e->si.comp,e->si.entonces);
+                rangosBloque(e->si.entonces,&rama);
+                liberarHechos(&rama);
+
+                copiarHechos(&rama,hechos);
+                rangosBloque(e->si.si_no,&rama);
+                liberarHechos(&rama);
+
+                olvidarModificaciones(hechos,e->si.entonces);
+                olvidarModificaciones(hechos,e->si.si_no);
+                break;
+            }
+            case ENUNC_MIENTRAS:
+                rangosCiclo(e,hechos);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Rangos ciclo
+ * @ingroup funciones_rangos
+ *
+ * Dentro del ciclo solo sobreviven los hechos de lo que no se modifica, mas lo que
+ * dice la condicion. Si el ciclo contado agrega a una lista en cada vuelta, al salir
+ * se sabe que la lista tiene por lo menos tantos elementos como el limite del ciclo.
+ *
+ * @param ciclo Enunciado del ciclo
+ * @param hechos Hechos conocidos antes del ciclo, al final quedan los de despues
+ */
+void rangosCiclo(Enunciado* ciclo, Hechos* hechos)
+{
+    Mientras* m = &ciclo->mientras;
+    double minimoInicio = 0, maximoInicio = 0;
+    int hayMinimo = 0, hayMaximo = 0;
+
+    rangosBloque(m->previo,hechos);
+
+    if(m->contador)
+    {
+        hayMinimo = buscarHecho(hechos,HECHO_MINIMO,m->inductor,NULL,&minimoInicio);
+        hayMaximo = buscarHecho(hechos,HECHO_MAXIMO,m->inductor,NULL,&maximoInicio);
+    }
+
+    Hechos dentro = {0};
+    copiarHechos(&dentro,hechos);
+    olvidarModificaciones(&dentro,m->cuerpo);
+    olvidarVariable(&dentro,m->contador);
+    olvidarVariable(&dentro,m->inductor);
+
+    //El for empieza en (long)inductor y solo sube
+    if(m->contador && m->paso > 0 && hayMinimo)
+        agregarHecho(&dentro,HECHO_MINIMO,m->contador,NULL,(double)(long)minimoInicio);
+
+    marcarIndice(&m->comp.izquierda,&dentro);
+    marcarIndice(&m->comp.derecha,&dentro);
+
+    agregarCondicion(&dentro,m->comp,m->cuerpo);
+    rangosBloque(m->cuerpo,&dentro);
+    liberarHechos(&dentro);
+
+    olvidarModificaciones(hechos,m->cuerpo);
+    olvidarVariable(hechos,m->contador);
+    olvidarVariable(hechos,m->inductor);
+
+    Valor limite = m->comp.derecha;
+    if(!m->contador || m->paso < 0 || !hayMaximo || limite.tipo != VAL_VARIABLE)
+        return;
+    if(m->comp.operador != OP_MENOR && m->comp.operador != OP_MENOR_IGUAL)
+        return;
+
+    Modificaciones mod = {0};
+    recolectarModificaciones(m->cuerpo,&mod,1);
+    int limiteFijo = !contieneConjunto(&mod.escalares,limite.nombre);
+    liberarModificaciones(&mod);
+
+    if(!limiteFijo)
+        return;
+
+    //Las vueltas son por lo menos limite - inicio, y cada vuelta agrega un elemento
+    for(Enunciado* e = m->cuerpo->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        if(e->tipo != ENUNC_ASIGNACION_LISTA && e->tipo != ENUNC_LEER_LISTA)
+            continue;
+
+        char* lista = e->tipo == ENUNC_LEER_LISTA ? e->leer.variable : e->asignacion.variable.nombre;
+        if(agregaCadaVuelta(m->cuerpo,lista))
+            agregarHecho(hechos,HECHO_COTA,limite.nombre,lista,-(double)techo(maximoInicio));
+    }
+}
+
+/**
+ * @brief Agregar condicion
+ *
+ * Si la condicion es entero < limite y se conoce una cota del limite, el entero
+ * queda por lo menos un lugar abajo de esa cota.
+ *
+ * @param hechos Hechos donde se agrega
+ * @param comp Condicion que se cumple al entrar al bloque
+ * @param cuerpo Bloque donde se cumple la condicion
+ */
+void agregarCondicion(Hechos* hechos, Comparacion comp, Programa* cuerpo)
+{
+    Valor izquierda = comp.izquierda;
+    Valor derecha = comp.derecha;
+
+    if(izquierda.tipo != VAL_VARIABLE || !izquierda.entero)
+        return;
+    if(comp.operador != OP_MENOR && comp.operador != OP_MENOR_IGUAL)
+        return;
+
+    int extra = comp.operador == OP_MENOR ? 1 : 0;
+
+    if(derecha.tipo == VAL_VARIABLE)
+    {
+        int cantidad = hechos->cantidad;
+        for(int i = 0; i < cantidad; i++)
+        {
+            Hecho h = hechos->hechos[i];
+            if(h.tipo == HECHO_COTA && !strcmp(h.variable,derecha.nombre) && h.k == (long)h.k)
+                agregarHecho(hechos,HECHO_COTA,izquierda.nombre,h.lista,h.k + extra);
+        }
+    }
+    else if(derecha.tipo == VAL_LISTA_S)
+    {
+        Conjunto declaradas = {0};
+        recolectarListasDeclaradas(cuerpo,&declaradas);
+        if(!contieneConjunto(&declaradas,derecha.nombre))
+            agregarHecho(hechos,HECHO_COTA,izquierda.nombre,derecha.nombre,extra);
+        liberarConjunto(&declaradas);
+    }
+}
+
+/**
+ * @brief Rangos asignacion
+ * @ingroup funciones_rangos
+ *
+ * Solo entiende sumas y restas, que se escriben en C igual que en la expresion,
+ * y lleva la cuenta de cuanto se mueve el primer termino.
+ *
+ * @param hechos Hechos conocidos antes de la asignacion
+ * @param variable Variable asignada
+ * @param expr Expresion asignada
+ */
+void rangosAsignacion(Hechos* hechos, char* variable, Expresion* expr)
+{
+    Hechos nuevos = {0};
+    int hayCota = 1, hayMinimo = 1, hayMaximo = 1;
+    double cota = 0, minimo = 0, maximo = 0;
+    char signo = '+';
+
+    for(Expresion* actual = expr; actual != NULL && (hayCota || hayMinimo || hayMaximo);)
+    {
+        Expresion* termino = actual->tipo == EXPR_VALOR ? actual : actual->binaria.izquierda;
+        if(termino->tipo != EXPR_VALOR)
+        {
+            hayCota = hayMinimo = hayMaximo = 0;
+            break;
+        }
+
+        Valor val = termino->valor;
+        double menor = 0, mayor = 0;
+        int conMenor = 0, conMayor = 0;
+
+        if(val.tipo == VAL_NUMERO)
+        {
+            menor = mayor = val.numero;
+            conMenor = conMayor = 1;
+        }
+        else if(val.tipo == VAL_VARIABLE)
+        {
+            conMenor = buscarHecho(hechos,HECHO_MINIMO,val.nombre,NULL,&menor);
+            conMayor = buscarHecho(hechos,HECHO_MAXIMO,val.nombre,NULL,&mayor);
+        }
+        else if(val.tipo == VAL_LISTA_S)
+            conMenor = 1;
+
+        if(actual == expr)
+        {
+            //Las cotas salen del primer termino
+            if(val.tipo == VAL_VARIABLE)
+            {
+                for(int i = 0; i < hechos->cantidad; i++)
+                    if(hechos->hechos[i].tipo == HECHO_COTA && !strcmp(hechos->hechos[i].variable,val.nombre))
+                        agregarHecho(&nuevos,HECHO_COTA,variable,hechos->hechos[i].lista,hechos->hechos[i].k);
+            }
+            else if(val.tipo == VAL_LISTA_S)
+                agregarHecho(&nuevos,HECHO_COTA,variable,val.nombre,0);
+
+            minimo = menor;
+            maximo = mayor;
+            hayMinimo = conMenor;
+            hayMaximo = conMayor;
+        }
+        else if(signo == '+')
+        {
+            //Sumar solo se permite con numeros para la cota
+            hayCota = hayCota && val.tipo == VAL_NUMERO;
+            cota -= mayor;
+            minimo += menor;
+            maximo += mayor;
+            hayMinimo = hayMinimo && conMenor;
+            hayMaximo = hayMaximo && conMayor;
+        }
+        else if(signo == '-')
+        {
+            hayCota = hayCota && conMenor;
+            cota += menor;
+            minimo -= mayor;
+            maximo -= menor;
+            hayMinimo = hayMinimo && conMayor;
+            hayMaximo = hayMaximo && conMenor;
+        }
+        else
+            hayCota = hayMinimo = hayMaximo = 0;
+
+        if(actual->tipo == EXPR_VALOR)
+            break;
+
+        char* op = actual->binaria.oparitmetico;
+        signo = (!strcmp(op,"+") || !strcmp(op,"-")) ? op[0] : '?';
+        actual = actual->binaria.derecha;
+    }
+
+    olvidarVariable(hechos,variable);
+
+    if(hayCota)
+        for(int i = 0; i < nuevos.cantidad; i++)
+            agregarHecho(hechos,HECHO_COTA,variable,nuevos.hechos[i].lista,nuevos.hechos[i].k + cota);
+    if(hayMinimo)
+        agregarHecho(hechos,HECHO_MINIMO,variable,NULL,minimo);
+    if(hayMaximo)
+        agregarHecho(hechos,HECHO_MAXIMO,variable,NULL,maximo);
+
+    liberarHechos(&nuevos);
+}
+
+/**
+ * @brief Marcar indice
+ * @ingroup funciones_rangos
+ *
+ * Un indice es seguro si es mayor o igual a cero y menor al tamaño de la lista.
+ *
+ * @param val Valor a marcar
+ * @param hechos Hechos conocidos en ese punto
+ */
+void marcarIndice(Valor* val, Hechos* hechos)
+{
+    double k;
+
+    if(val->tipo == VAL_LISTA_INDEX_VAR)
+    {
+        double minimo;
+        if(buscarHecho(hechos,HECHO_MINIMO,val->var,NULL,&minimo) && minimo >= 0
+            && buscarHecho(hechos,HECHO_COTA,val->var,val->nombre,&k) && k >= 1)
+            val->seguro = 1;
+    }
+    else if(val->tipo == VAL_LISTA_INDEX && val->indice >= 0)
+    {
+        //tamaño >= variable + k >= minimo + k
+        for(int i = 0; i < hechos->cantidad; i++)
+        {
+            Hecho h = hechos->hechos[i];
+            double minimo;
+            if(h.tipo == HECHO_COTA && !strcmp(h.lista,val->nombre)
+                && buscarHecho(hechos,HECHO_MINIMO,h.variable,NULL,&minimo) && val->indice <= minimo + h.k - 1)
+                val->seguro = 1;
+        }
+    }
+}
+
+/**
+ * @brief Marcar indices expresion
+ * @ingroup funciones_rangos
+ *
+ * @param expr Expresion a marcar
+ * @param hechos Hechos conocidos en ese punto
+ */
+void marcarIndicesExpresion(Expresion* expr, Hechos* hechos)
+{
+    if(!expr)
+        return;
+
+    if(expr->tipo == EXPR_VALOR)
+        marcarIndice(&expr->valor,hechos);
+    else
+    {
+        marcarIndicesExpresion(expr->binaria.izquierda,hechos);
+        marcarIndicesExpresion(expr->binaria.derecha,hechos);
+    }
+}
+
+/**
+ * @brief Agrega cada vuelta
+ * @ingroup funciones_rangos
+ *
+ * @param cuerpo Cuerpo del ciclo
+ * @param lista Nombre de la lista
+ *
+ * @return int Si el cuerpo siempre agrega a la lista sin volver a declararla
+ */
+int agregaCadaVuelta(Programa* cuerpo, char* lista)
+{
+    int agrega = 0;
+
+    //Si se carga en cualquier parte del cuerpo la lista puede quedar mas chica
+    Conjunto reemplazadas = {0};
+    recolectarListasDeclaradas(cuerpo,&reemplazadas);
+    int reemplazada = contieneConjunto(&reemplazadas,lista);
+    liberarConjunto(&reemplazadas);
+    if(reemplazada)
+        return 0;
+
+    for(Enunciado* e = cuerpo->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        if(e->tipo == ENUNC_DECLARACION_LISTA)
+            for(int i = 0; i < e->declaracion.cantidad; i++)
+                if(!strcmp(e->declaracion.variables[i],lista))
+                    return 0;
+
+        if(e->tipo == ENUNC_ASIGNACION_LISTA && !strcmp(e->asignacion.variable.nombre,lista))
+            agrega = 1;
+        if(e->tipo == ENUNC_LEER_LISTA && !strcmp(e->leer.variable,lista))
+            agrega = 1;
+    }
+
+    return agrega;
+}
+
+/**
+ * @brief Recolectar listas declaradas
+ * @ingroup funciones_rangos
+ *
+ * @param bloque Bloque a revisar
+ * @param listas Conjunto donde se guardan las listas declaradas con nexus o cargadas de un archivo
+ */
+void recolectarListasDeclaradas(Programa* bloque, Conjunto* listas)
+{
+    if(!bloque)
+        return;
+
+    for(Enunciado* e = bloque->lista_enunciados; e != NULL; e = e->siguiente)
+    {
+        switch(e->tipo)
+        {
+            case ENUNC_DECLARACION_LISTA:
+                for(int i = 0; i < e->declaracion.cantidad; i++)
+                    agregarConjunto(listas,e->declaracion.variables[i]);
+                break;
+            case ENUNC_CARGAR_LISTA:
+                agregarConjunto(listas,e->archivo.lista);
+                break;
+            case ENUNC_SI:
+                recolectarListasDeclaradas(e->si.entonces,listas);
+                recolectarListasDeclaradas(e->si.si_no,listas);
+                break;
+            case ENUNC_MIENTRAS:
+                recolectarListasDeclaradas(e->mientras.previo,listas);
+                recolectarListasDeclaradas(e->mientras.cuerpo,listas);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Agregar hecho
+ * @ingroup funciones_hechos
+ *
+ * Si ya existe un hecho del mismo tipo se queda el mas fuerte.
+ *
+ * @param hechos Conjunto de hechos
+ * @param tipo Tipo de hecho
+ * @param variable Variable del hecho
+ * @param lista Lista del hecho si es cota
+ * @param k Constante del hecho
+ */
+void agregarHecho(Hechos* hechos, TipoHecho tipo, char* variable, char* lista, double k)
+{
+    for(int i = 0; i < hechos->cantidad; i++)
+    {
+        Hecho* h = &hechos->hechos[i];
+        if(h->tipo != tipo || strcmp(h->variable,variable))
+            continue;
+        if(tipo == HECHO_COTA && strcmp(h->lista,lista))
+            continue;
+
+        if(tipo == HECHO_MAXIMO ? k < h->k : k > h->k)
+            h->k = k;
+        return;
+    }
+
+    hechos->hechos = (Hecho*)realloc(hechos->hechos,(hechos->cantidad + 1) * sizeof(Hecho));
+    hechos->hechos[hechos->cantidad].tipo = tipo;
+    hechos->hechos[hechos->cantidad].variable = variable;
+    hechos->hechos[hechos->cantidad].lista = lista;
+    hechos->hechos[hechos->cantidad].k = k;
+    hechos->cantidad++;
+}
+
+/**
+ * @brief Buscar hecho
+ * @ingroup funciones_hechos
+ *
+ * @param hechos Conjunto de hechos
+ * @param tipo Tipo de hecho
+ * @param variable Variable del hecho
+ * @param lista Lista del hecho si es cota
+ * @param k Donde se guarda la constante del hecho
+ *
+ * @return int Si se encontro el hecho
+ */
+int buscarHecho(Hechos* hechos, TipoHecho tipo, char* variable, char* lista, double* k)
+{
+    if(!variable)
+        return 0;
+
+    for(int i = 0; i < hechos->cantidad; i++)
+    {
+        Hecho h = hechos->hechos[i];
+        if(h.tipo != tipo || strcmp(h.variable,variable))
+            continue;
+        if(tipo == HECHO_COTA && strcmp(h.lista,lista))
+            continue;
+
+        *k = h.k;
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Olvidar variable
+ * @ingroup funciones_hechos
+ *
+ * @param hechos Conjunto de hechos
+ * @param variable Variable que cambio de valor
+ */
+void olvidarVariable(Hechos* hechos, char* variable)
+{
+    if(!variable)
+        return;
+
+    int j = 0;
+    for(int i = 0; i < hechos->cantidad; i++)
+        if(strcmp(hechos->hechos[i].variable,variable))
+            hechos->hechos[j++] = hechos->hechos[i];
+    hechos->cantidad = j;
+}
+
+/**
+ * @brief Olvidar lista
+ * @ingroup funciones_hechos
+ *
+ * @param hechos Conjunto de hechos
+ * @param lista Lista que se volvio a declarar
+ */
+void olvidarLista(Hechos* hechos, char* lista)
+{
+    int j = 0;
+    for(int i = 0; i < hechos->cantidad; i++)
+        if(hechos->hechos[i].tipo != HECHO_COTA || strcmp(hechos->hechos[i].lista,lista))
+            hechos->hechos[j++] = hechos->hechos[i];
+    hechos->cantidad = j;
+}
+
+/**
+ * @brief Olvidar modificaciones
+ * @ingroup funciones_hechos
+ *
+ * Olvida todo lo que se sabe de las variables y listas que cambian dentro del bloque.
+ *
+ * @param hechos Conjunto de hechos
+ * @param bloque Bloque que modifica
+ */
+void olvidarModificaciones(Hechos* hechos, Programa* bloque)
+{
+    Modificaciones mod = {0};
+    recolectarModificaciones(bloque,&mod,1);
+    for(int i = 0; i < mod.escalares.cantidad; i++)
+        olvidarVariable(hechos,mod.escalares.nombres[i]);
+    liberarModificaciones(&mod);
+
+    Conjunto declaradas = {0};
+    recolectarListasDeclaradas(bloque,&declaradas);
+    for(int i = 0; i < declaradas.cantidad; i++)
+        olvidarLista(hechos,declaradas.nombres[i]);
+    liberarConjunto(&declaradas);
+}
+
+/**
+ * @brief Copiar hechos
+ * @ingroup funciones_hechos
+ *
+ * @param destino Conjunto vacio donde se copia
+ * @param origen Conjunto a copiar
+ */
+void copiarHechos(Hechos* destino, Hechos* origen)
+{
+    destino->cantidad = origen->cantidad;
+    destino->hechos = (Hecho*)malloc((origen->cantidad + 1) * sizeof(Hecho));
+    for(int i = 0; i < origen->cantidad; i++)
+        destino->hechos[i] = origen->hechos[i];
+}
+
+/**
+ * @brief Liberar hechos
+ * @ingroup funciones_hechos
+ *
+ * @param hechos Conjunto a liberar
+ */
+void liberarHechos(Hechos* hechos)
+{
+    free(hechos->hechos);
+    hechos->hechos = NULL;
+    hechos->cantidad = 0;
+}
+
+/**
+ * @brief Techo
+ *
+ * @param numero Numero a redondear
+ *
+ * @return long Entero mas chico que es mayor o igual al numero
+ */
+long techo(double numero)
+{
+    long t = (long)numero;
+    if(t < numero)
+        t++;
+    return t;
+}
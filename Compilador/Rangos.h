@@ -0,0 +1,67 @@
+/**
+ * @file Rangos.h
+ * @brief Prototipos y estructuras del analisis de rangos de los indices.
+ *
+ * Este archivo contiene las estructuras necesarias para saber
+ * que indices de listas siempre estan dentro de la lista y
+ * no necesitan revisarse en el modo --checked.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+#include "Optimizador.h"
+
+/**
+ * @brief Tipos de hechos que se conocen de una variable
+ */
+typedef enum {
+    HECHO_COTA, /**< variable <= tamaño(lista) - k */
+    HECHO_MINIMO, /**< variable >= k */
+    HECHO_MAXIMO /**< variable <= k */
+} TipoHecho;
+
+/**
+ * @brief Hecho conocido de una variable en un punto del programa
+ */
+typedef struct {
+    TipoHecho tipo; /**< Tipo de hecho */
+    char* variable; /**< Variable de la que se sabe el hecho */
+    char* lista; /**< Lista con la que se compara si es cota */
+    double k; /**< Constante del hecho */
+} Hecho;
+
+/**
+ * @brief Conjunto de hechos validos en un punto del programa
+ */
+typedef struct {
+    Hecho* hechos; /**< Hechos almacenados */
+    int cantidad; /**< Cantidad de hechos almacenados */
+} Hechos;
+
+/**
+ * @defgroup funciones_rangos Funciones del analisis de rangos
+ * @{
+ */
+void analizarRangos(Programa* programa);
+void rangosBloque(Programa* bloque, Hechos* hechos);
+void rangosCiclo(Enunciado* ciclo, Hechos* hechos);
+void rangosAsignacion(Hechos* hechos, char* variable, Expresion* expr);
+void marcarIndice(Valor* val, Hechos* hechos);
+void marcarIndicesExpresion(Expresion* expr, Hechos* hechos);
+int agregaCadaVuelta(Programa* cuerpo, char* lista);
+void recolectarListasDeclaradas(Programa* bloque, Conjunto* listas);
+/** @} */
+
+/**
+ * @defgroup funciones_hechos Funciones del conjunto de hechos
+ * @{
+ */
+void agregarHecho(Hechos* hechos, TipoHecho tipo, char* variable, char* lista, double k);
+int buscarHecho(Hechos* hechos, TipoHecho tipo, char* variable, char* lista, double* k);
+void olvidarVariable(Hechos* hechos, char* variable);
+void olvidarLista(Hechos* hechos, char* lista);
+void olvidarModificaciones(Hechos* hechos, Programa* bloque);
+void copiarHechos(Hechos* destino, Hechos* origen);
+void liberarHechos(Hechos* hechos);
+/** @} */
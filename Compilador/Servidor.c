@@ -0,0 +1,650 @@
+/**
+ * @file Servidor.c
+ * @brief Implementación del servidor de compilacion y de su cliente.
+ *
+ * El servidor se queda corriendo con los Listas.o ya compilados para cada tipo
+ * de numero y con los ejecutables que ya compilo, guardados con el hash del
+ * programa y sus opciones, asi una peticion repetida no llama a gcc. Cada
+ * ejecutable se guarda junto con la peticion que lo creo y se compara antes de
+ * usarlo, porque dos programas distintos pueden tener el mismo hash. Cada hilo
+ * acepta conexiones y atiende una peticion por conexion con su propio contexto.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include "Servidor.h"
+#include "Lote.h"
+
+/**@cond */
+uint64_t hashPeticion(Peticion* peticion, char* nombre, char* fuente);
+void responder(int conexion, EstadoRespuesta estado, int linea, int columna);
+int enviarEjecutable(int conexion, int archivo);
+int mismaPeticion(int archivo, Peticion* peticion, char* nombre, char* fuente);
+int guardarEjecutable(const char* ejecutable, const char* final, Peticion* peticion, char* nombre, char* fuente);
+int llenarDireccion(struct sockaddr_un* direccion, const char* ruta);
+void borrarCarpeta(const char* carpeta);
+void limitarCache(const char* carpeta);
+/**@endcond */
+
+/**
+ * @brief Servidor
+ * @ingroup funciones_servidor
+ *
+ * Escucha en el socket hasta recibir SIGINT o SIGTERM, despues espera a que los
+ * hilos terminen su peticion y borra el socket y los ejecutables guardados.
+ *
+ * @param ruta Ruta del socket de Unix
+ * @param hilos Peticiones que se atienden al mismo tiempo
+ *
+ * @return int 0 si termino bien, 1 si no se pudo crear el socket
+ */
+int servidor(const char* ruta, int hilos)
+{
+    Servidor srv;
+    memset(&srv,0,sizeof(Servidor));
+    pthread_mutex_init(&srv.candado,NULL);
+
+    struct sockaddr_un direccion;
+    if(!llenarDireccion(&direccion,ruta))
+    {
+        printf("Ruta del socket muy larga: %s\n",ruta);
+        return 1;
+    }
+
+    //Si alguien responde en el socket ya hay un servidor, si no es un socket viejo
+    int otro = conectar(ruta);
+    if(otro >= 0)
+    {
+        close(otro);
+        printf("Ya hay un servidor en %s\n",ruta);
+        return 1;
+    }
+    unlink(ruta);
+
+    snprintf(srv.carpeta,sizeof(srv.carpeta),"/tmp/wwe_servidor_XXXXXX");
+    srv.socket = socket(AF_UNIX,SOCK_STREAM,0);
+    if(!mkdtemp(srv.carpeta) || srv.socket < 0
+        || bind(srv.socket,(struct sockaddr*)&direccion,sizeof(direccion)) < 0
+        || listen(srv.socket,SOMAXCONN) < 0)
+    {
+        printf("No se pudo crear el servidor en %s: %s\n",ruta,strerror(errno));
+        return 1;
+    }
+
+    //Las señales solo las recibe este hilo, los demas las heredan bloqueadas
+    sigset_t senales;
+    sigemptyset(&senales);
+    sigaddset(&senales,SIGINT);
+    sigaddset(&senales,SIGTERM);
+    pthread_sigmask(SIG_BLOCK,&senales,NULL);
+    signal(SIGPIPE,SIG_IGN);
+
+    pthread_t* ids = (pthread_t*)malloc(sizeof(pthread_t) * hilos);
+    int creados = 0;
+    for(; creados < hilos; creados++)
+        if(pthread_create(&ids[creados],NULL,atenderServidor,&srv) != 0)
+            break;
+
+    printf("Servidor escuchando en %s con %d hilos\n",ruta,creados);
+    fflush(stdout);
+
+    int senal;
+    sigwait(&senales,&senal);
+
+    //shutdown despierta a los hilos que esperan en accept
+    shutdown(srv.socket,SHUT_RDWR);
+    for(int i = 0; i < creados; i++)
+        pthread_join(ids[i],NULL);
+    free(ids);
+
+    close(srv.socket);
+    unlink(ruta);
+    borrarCarpeta(srv.carpeta);
+    pthread_mutex_destroy(&srv.candado);
+    return 0;
+}
+
+/**
+ * @brief Atender servidor
+ * @ingroup funciones_servidor
+ *
+ * Hilo del servidor, acepta conexiones hasta que se cierra el socket.
+ *
+ * @param argumento Servidor
+ *
+ * @return void* NULL
+ */
+void* atenderServidor(void* argumento)
+{
+    Servidor* srv = (Servidor*)argumento;
+
+    while(1)
+    {
+        int conexion = accept(srv->socket,NULL,NULL);
+        if(conexion < 0)
+        {
+            if(errno == EINTR || errno == ECONNABORTED)
+                continue;
+            break;
+        }
+
+        //Un cliente que deja de mandar o de leer no puede quedarse con el hilo
+        struct timeval espera = {ESPERA_SERVIDOR,0};
+        setsockopt(conexion,SOL_SOCKET,SO_RCVTIMEO,&espera,sizeof(espera));
+        setsockopt(conexion,SOL_SOCKET,SO_SNDTIMEO,&espera,sizeof(espera));
+        atenderPeticion(srv,conexion);
+        close(conexion);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Atender peticion
+ * @ingroup funciones_servidor
+ *
+ * Lee el programa y sus opciones, y responde con el ejecutable guardado si ya se
+ * compilo uno igual o con uno nuevo. Si no se pudo compilar responde por que.
+ * Si el guardado con el mismo hash es de otra peticion se compila de nuevo y se reemplaza.
+ * Los ejecutables guardados no pasan de CACHE_SERVIDOR bytes.
+ *
+ * @param srv Servidor
+ * @param conexion Socket de la conexion con el cliente
+ */
+void atenderPeticion(Servidor* srv, int conexion)
+{
+    Peticion peticion;
+    if(!leerTodo(conexion,&peticion,sizeof(Peticion)) || peticion.magia != MAGIA_SERVIDOR
+        || peticion.tamNombre == 0 || peticion.tamNombre > 4096 || peticion.tamFuente > (64 << 20)
+        || peticion.opciones[0] < NUM_FLOAT || peticion.opciones[0] > NUM_INT64)
+    {
+        responder(conexion,RESPUESTA_FALLA,0,0);
+        return;
+    }
+
+    char* nombre = (char*)calloc(peticion.tamNombre + 1,1);
+    char* fuente = (char*)malloc(peticion.tamFuente + 1);
+    if(!leerTodo(conexion,nombre,peticion.tamNombre) || !leerTodo(conexion,fuente,peticion.tamFuente))
+    {
+        responder(conexion,RESPUESTA_FALLA,0,0);
+        free(nombre);
+        free(fuente);
+        return;
+    }
+
+    char final[320];
+    snprintf(final,sizeof(final),"%s/%016llx",srv->carpeta,
+        (unsigned long long)hashPeticion(&peticion,nombre,fuente));
+
+    int archivo = open(final,O_RDONLY);
+    if(archivo >= 0 && !mismaPeticion(archivo,&peticion,nombre,fuente))
+    {
+        close(archivo);
+        archivo = -1;
+    }
+
+    //La fecha del ejecutable es la de su ultimo uso, limitarCache borra primero los mas viejos
+    if(archivo >= 0)
+        futimens(archivo,NULL);
+    else
+    {
+        Opciones opciones = OPCIONES_DEFECTO;
+        opciones.numero = (TipoNumero)peticion.opciones[0];
+        opciones.checked = peticion.opciones[1] != 0;
+        opciones.ordenamientos = peticion.opciones[2] != 0;
+        opciones.paralelo = peticion.opciones[3] != 0;
+        opciones.perfil = peticion.opciones[4] != 0;
+        opciones.depuracion = peticion.opciones[5] != 0;
+
+        //Se compila con un nombre propio y se renombra, asi otro hilo nunca ve un ejecutable a medias
+        char temporal[352];
+        snprintf(temporal,sizeof(temporal),"%s_%ld",final,__atomic_fetch_add(&srv->siguiente,1,__ATOMIC_RELAXED));
+
+        Contexto ctx;
+        char objeto[320];
+        inicializarContexto(&ctx,nombre,temporal,&opciones);
+        ctx.fuente = fuente;
+        ctx.tamFuente = peticion.tamFuente;
+        ctx.listas = listasServidor(srv,&opciones,objeto,sizeof(objeto));
+
+        int compilado = compilar(&ctx);
+        if(compilado)
+            archivo = guardarEjecutable(temporal,final,&peticion,nombre,fuente);
+        if(archivo >= 0)
+            limitarCache(srv->carpeta);
+        else if(compilado)
+            responder(conexion,RESPUESTA_FALLA,0,0);
+        else if(!ctx.tokens.inicio)
+            responder(conexion,RESPUESTA_VACIO,0,0);
+        else if(!ctx.programa)
+            responder(conexion,RESPUESTA_INCORRECTO,ctx.lineaError,ctx.columnaError);
+        else
+            responder(conexion,RESPUESTA_GCC,0,0);
+        liberarContexto(&ctx);
+    }
+
+    if(archivo >= 0)
+    {
+        if(!enviarEjecutable(conexion,archivo))
+            responder(conexion,RESPUESTA_FALLA,0,0);
+        close(archivo);
+    }
+
+    free(nombre);
+    free(fuente);
+}
+
+/**
+ * @brief Listas del servidor
+ * @ingroup funciones_servidor
+ *
+ * Regresa el Listas.o compilado con el tipo de numero y la depuracion de las
+ * opciones, compilandolo la primera vez que se pide.
+ *
+ * @param srv Servidor
+ * @param opciones Opciones de la peticion
+ * @param objeto Donde se escribe la ruta del objeto
+ * @param tam Tamaño de objeto
+ *
+ * @return const char* objeto, o NULL si no se pudo compilar y se debe usar Listas.c
+ */
+const char* listasServidor(Servidor* srv, Opciones* opciones, char* objeto, int tam)
+{
+    int depuracion = opciones->depuracion != 0;
+    snprintf(objeto,tam,"%s/listas_%d_%d.o",srv->carpeta,opciones->numero,depuracion);
+
+    pthread_mutex_lock(&srv->candado);
+    int* estado = &srv->listas[opciones->numero][depuracion];
+    if(*estado == 0)
+        *estado = compilarListas(opciones,objeto) ? 1 : -1;
+    int listo = *estado == 1;
+    pthread_mutex_unlock(&srv->candado);
+
+    return listo ? objeto : NULL;
+}
+
+/**
+ * @brief Compilar remoto
+ * @ingroup funciones_servidor
+ *
+ * Manda el programa del contexto al servidor de --connect y guarda el ejecutable
+ * que regresa. Escribe los mismos mensajes que una compilacion local, aunque de
+ * un error del parser solo se sabe la linea y la columna.
+ *
+ * @param ctx Contexto con el archivo a compilar y el servidor en sus opciones
+ *
+ * @return int 1 si se creo el ejecutable, 0 si no, -1 si no hay servidor y se debe compilar aqui
+ */
+int compilarRemoto(Contexto* ctx)
+{
+    const char* fuente = ctx->fuente;
+    size_t tamFuente = ctx->tamFuente;
+    char* leida = NULL;
+
+    if(!fuente)
+    {
+        leida = leerArchivo(ctx->filename,&tamFuente);
+        if(!leida)
+            return -1;
+        fuente = leida;
+    }
+
+    int conexion = conectar(ctx->opciones.servidor);
+    if(conexion < 0)
+    {
+        printf("No se pudo conectar con el servidor %s, se compila aqui\n",ctx->opciones.servidor);
+        free(leida);
+        return -1;
+    }
+
+    Opciones* op = &ctx->opciones;
+    Peticion peticion = {MAGIA_SERVIDOR,{op->numero,op->checked,op->ordenamientos,op->paralelo,op->perfil,op->depuracion},
+        (uint32_t)strlen(ctx->filename),tamFuente};
+    Respuesta respuesta;
+
+    int correcto = escribirTodo(conexion,&peticion,sizeof(Peticion))
+        && escribirTodo(conexion,ctx->filename,peticion.tamNombre)
+        && escribirTodo(conexion,fuente,tamFuente)
+        && leerTodo(conexion,&respuesta,sizeof(Respuesta));
+    free(leida);
+
+    int res = 0;
+    if(!correcto)
+        printf("Se perdio la conexion con el servidor %s\n",ctx->opciones.servidor);
+    else if(respuesta.estado == RESPUESTA_LISTA)
+    {
+        int archivo = open(ctx->archivo_salida,O_WRONLY | O_CREAT | O_TRUNC,0777);
+        char bloque[65536];
+        uint64_t restante = respuesta.tamEjecutable;
+        res = archivo >= 0;
+        while(res && restante > 0)
+        {
+            size_t tam = restante < sizeof(bloque) ? restante : sizeof(bloque);
+            res = leerTodo(conexion,bloque,tam) && escribirTodo(archivo,bloque,tam);
+            restante -= tam;
+        }
+        if(archivo >= 0)
+            close(archivo);
+        //No se deja un ejecutable a medias que parezca bueno
+        if(!res)
+        {
+            if(archivo >= 0)
+                unlink(ctx->archivo_salida);
+            printf("No se pudo guardar %s\n",ctx->archivo_salida);
+        }
+    }
+    else if(respuesta.estado == RESPUESTA_VACIO)
+        errorCompilacion(ctx,"El archivo esta vacio");
+    else if(respuesta.estado == RESPUESTA_INCORRECTO)
+    {
+        ctx->lineaError = respuesta.linea;
+        ctx->columnaError = respuesta.columna;
+        errorCompilacion(ctx,"Error en línea %d, columna %d",respuesta.linea,respuesta.columna);
+        errorCompilacion(ctx,"El programa no esta correcto");
+    }
+    else if(respuesta.estado == RESPUESTA_GCC)
+        errorCompilacion(ctx,"Error al compilar");
+    else
+        printf("El servidor %s no pudo compilar %s\n",ctx->opciones.servidor,ctx->filename);
+
+    close(conexion);
+    return res;
+}
+
+/**
+ * @brief Conectar
+ * @ingroup funciones_servidor
+ *
+ * @param ruta Ruta del socket del servidor
+ *
+ * @return int Socket conectado, -1 si no hay servidor
+ */
+int conectar(const char* ruta)
+{
+    struct sockaddr_un direccion;
+    if(!llenarDireccion(&direccion,ruta))
+        return -1;
+
+    int conexion = socket(AF_UNIX,SOCK_STREAM,0);
+    if(conexion < 0)
+        return -1;
+    if(connect(conexion,(struct sockaddr*)&direccion,sizeof(direccion)) < 0)
+    {
+        close(conexion);
+        return -1;
+    }
+    return conexion;
+}
+
+/**
+ * @brief Escribir todo
+ * @ingroup funciones_servidor
+ *
+ * Escribe todos los bytes aunque el sistema los acepte por partes. En un socket
+ * un cliente que ya se fue no manda SIGPIPE, solo regresa error.
+ *
+ * @param fd Socket o archivo
+ * @param datos Bytes a escribir
+ * @param tam Cantidad de bytes
+ *
+ * @return int Si se escribieron todos
+ */
+int escribirTodo(int fd, const void* datos, size_t tam)
+{
+    const char* p = (const char*)datos;
+    while(tam > 0)
+    {
+        ssize_t n = send(fd,p,tam,MSG_NOSIGNAL);
+        if(n < 0 && errno == ENOTSOCK)
+            n = write(fd,p,tam);
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+            return 0;
+        p += n;
+        tam -= n;
+    }
+    return 1;
+}
+
+/**
+ * @brief Leer todo
+ * @ingroup funciones_servidor
+ *
+ * @param fd Socket o archivo
+ * @param datos Donde se guardan los bytes
+ * @param tam Cantidad de bytes que se esperan
+ *
+ * @return int Si llegaron todos antes de que se cerrara la conexion
+ */
+int leerTodo(int fd, void* datos, size_t tam)
+{
+    char* p = (char*)datos;
+    while(tam > 0)
+    {
+        ssize_t n = read(fd,p,tam);
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+            return 0;
+        p += n;
+        tam -= n;
+    }
+    return 1;
+}
+
+/**@cond */
+
+/*
+ * FNV-1a de las opciones, el nombre y el texto, los tres cambian el ejecutable
+ */
+uint64_t hashPeticion(Peticion* peticion, char* nombre, char* fuente)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    const unsigned char* partes[3] = {(unsigned char*)peticion->opciones,(unsigned char*)nombre,(unsigned char*)fuente};
+    size_t tams[3] = {sizeof(peticion->opciones),peticion->tamNombre,peticion->tamFuente};
+
+    for(int i = 0; i < 3; i++)
+        for(size_t j = 0; j < tams[i]; j++)
+        {
+            hash ^= partes[i][j];
+            hash *= 1099511628211ULL;
+        }
+    return hash;
+}
+
+/*
+ * Respuesta sin ejecutable
+ */
+void responder(int conexion, EstadoRespuesta estado, int linea, int columna)
+{
+    Respuesta respuesta = {estado,linea,columna,0};
+    escribirTodo(conexion,&respuesta,sizeof(Respuesta));
+}
+
+/*
+ * Respuesta con el ejecutable ya compilado, el archivo ya esta en el inicio del ejecutable
+ */
+int enviarEjecutable(int conexion, int archivo)
+{
+    struct stat datos;
+    off_t inicio = lseek(archivo,0,SEEK_CUR);
+    if(fstat(archivo,&datos) < 0 || inicio < 0 || inicio > datos.st_size)
+        return 0;
+
+    Respuesta respuesta = {RESPUESTA_LISTA,0,0,(uint64_t)(datos.st_size - inicio)};
+    if(!escribirTodo(conexion,&respuesta,sizeof(Respuesta)))
+        return 1;
+
+    char bloque[65536];
+    ssize_t n;
+    while((n = read(archivo,bloque,sizeof(bloque))) > 0)
+        if(!escribirTodo(conexion,bloque,n))
+            break;
+    return 1;
+}
+
+/*
+ * Lee la peticion guardada al inicio del archivo y la compara con la que llego,
+ * si son iguales el archivo queda en el inicio del ejecutable
+ */
+int mismaPeticion(int archivo, Peticion* peticion, char* nombre, char* fuente)
+{
+    Peticion guardada;
+    if(!leerTodo(archivo,&guardada,sizeof(Peticion)) || guardada.tamNombre != peticion->tamNombre
+        || guardada.tamFuente != peticion->tamFuente || memcmp(guardada.opciones,peticion->opciones,sizeof(peticion->opciones)))
+        return 0;
+
+    char* texto = (char*)malloc(peticion->tamNombre + peticion->tamFuente + 1);
+    int igual = texto && leerTodo(archivo,texto,peticion->tamNombre + peticion->tamFuente)
+        && !memcmp(texto,nombre,peticion->tamNombre) && !memcmp(texto + peticion->tamNombre,fuente,peticion->tamFuente);
+    free(texto);
+    return igual;
+}
+
+/*
+ * Escribe la peticion seguida del ejecutable en un archivo nuevo, lo renombra a final y borra
+ * el ejecutable. Regresa el archivo en el inicio del ejecutable, o -1 si no se pudo guardar
+ */
+int guardarEjecutable(const char* ejecutable, const char* final, Peticion* peticion, char* nombre, char* fuente)
+{
+    char ruta[368];
+    snprintf(ruta,sizeof(ruta),"%s_g",ejecutable);
+
+    int origen = open(ejecutable,O_RDONLY);
+    int archivo = open(ruta,O_RDWR | O_CREAT | O_EXCL,0600);
+    int correcto = origen >= 0 && archivo >= 0 && escribirTodo(archivo,peticion,sizeof(Peticion))
+        && escribirTodo(archivo,nombre,peticion->tamNombre) && escribirTodo(archivo,fuente,peticion->tamFuente);
+
+    char bloque[65536];
+    ssize_t n = 0;
+    while(correcto && (n = read(origen,bloque,sizeof(bloque))) > 0)
+        correcto = escribirTodo(archivo,bloque,n);
+    correcto = correcto && n == 0 && rename(ruta,final) == 0
+        && lseek(archivo,sizeof(Peticion) + peticion->tamNombre + peticion->tamFuente,SEEK_SET) >= 0;
+
+    if(origen >= 0)
+        close(origen);
+    unlink(ejecutable);
+    if(!correcto)
+    {
+        if(archivo >= 0)
+            close(archivo);
+        unlink(ruta);
+        return -1;
+    }
+    return archivo;
+}
+
+int llenarDireccion(struct sockaddr_un* direccion, const char* ruta)
+{
+    memset(direccion,0,sizeof(struct sockaddr_un));
+    direccion->sun_family = AF_UNIX;
+    if(strlen(ruta) >= sizeof(direccion->sun_path))
+        return 0;
+    strcpy(direccion->sun_path,ruta);
+    return 1;
+}
+
+void borrarCarpeta(const char* carpeta)
+{
+    DIR* dir = opendir(carpeta);
+    if(!dir)
+        return;
+
+    char ruta[512];
+    struct dirent* entrada;
+    while((entrada = readdir(dir)) != NULL)
+    {
+        if(!strcmp(entrada->d_name,".") || !strcmp(entrada->d_name,".."))
+            continue;
+        snprintf(ruta,sizeof(ruta),"%s/%s",carpeta,entrada->d_name);
+        unlink(ruta);
+    }
+    closedir(dir);
+    rmdir(carpeta);
+}
+
+/*
+ * Los ejecutables guardados se llaman con los 16 digitos del hash, los temporales y los Listas.o no
+ */
+typedef struct {
+    char nombre[17];
+    off_t tam;
+    struct timespec uso;
+} Guardado;
+
+int compararGuardados(const void* a, const void* b)
+{
+    const struct timespec* x = &((const Guardado*)a)->uso;
+    const struct timespec* y = &((const Guardado*)b)->uso;
+    if(x->tv_sec != y->tv_sec)
+        return x->tv_sec < y->tv_sec ? -1 : 1;
+    return (x->tv_nsec > y->tv_nsec) - (x->tv_nsec < y->tv_nsec);
+}
+
+/*
+ * Borra los ejecutables usados hace mas tiempo hasta que los guardados quepan en CACHE_SERVIDOR.
+ * Si dos hilos limpian a la vez a lo mucho se borra de mas, y un ejecutable borrado que otro
+ * hilo ya abrio se sigue mandando completo.
+ */
+void limitarCache(const char* carpeta)
+{
+    DIR* dir = opendir(carpeta);
+    if(!dir)
+        return;
+
+    Guardado* guardados = NULL;
+    int cantidad = 0, capacidad = 0;
+    long total = 0;
+    char ruta[512];
+    struct stat datos;
+    struct dirent* entrada;
+    while((entrada = readdir(dir)) != NULL)
+    {
+        if(strlen(entrada->d_name) != 16 || strchr(entrada->d_name,'_') || strchr(entrada->d_name,'.'))
+            continue;
+        snprintf(ruta,sizeof(ruta),"%s/%s",carpeta,entrada->d_name);
+        if(stat(ruta,&datos) < 0)
+            continue;
+        if(cantidad == capacidad)
+        {
+            capacidad = capacidad ? capacidad * 2 : 64;
+            Guardado* nuevos = (Guardado*)realloc(guardados,capacidad * sizeof(Guardado));
+            if(!nuevos)
+                break;
+            guardados = nuevos;
+        }
+        strcpy(guardados[cantidad].nombre,entrada->d_name);
+        guardados[cantidad].tam = datos.st_size;
+        guardados[cantidad].uso = datos.st_mtim;
+        total += datos.st_size;
+        cantidad++;
+    }
+    closedir(dir);
+
+    if(total > CACHE_SERVIDOR)
+    {
+        qsort(guardados,cantidad,sizeof(Guardado),compararGuardados);
+        for(int i = 0; i < cantidad && total > CACHE_SERVIDOR; i++)
+        {
+            snprintf(ruta,sizeof(ruta),"%s/%s",carpeta,guardados[i].nombre);
+            if(unlink(ruta) == 0)
+                total -= guardados[i].tam;
+        }
+    }
+    free(guardados);
+}
+
+/**@endcond */
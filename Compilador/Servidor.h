@@ -0,0 +1,91 @@
+/**
+ * @file Servidor.h
+ * @brief Prototipos y estructuras del servidor de compilacion.
+ *
+ * Este archivo contiene lo necesario para wwe --server, que compila los
+ * programas que le mandan por un socket de Unix sin volver a arrancar el
+ * compilador, y para el cliente que usa wwe con --connect o WWE_SERVIDOR.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+#include <stdint.h>
+#include <pthread.h>
+#include "Contexto.h"
+
+/**
+ * @brief Primeros bytes de cada peticion, "WWE1"
+ */
+#define MAGIA_SERVIDOR 0x31455757
+
+/**
+ * @brief Segundos que el servidor espera a que un cliente mande o reciba datos antes de cerrar la conexion
+ */
+#define ESPERA_SERVIDOR 10
+
+/**
+ * @brief Bytes de ejecutables que guarda el servidor, al pasarse borra los que se usaron hace mas tiempo
+ */
+#define CACHE_SERVIDOR (256L << 20)
+
+/**
+ * @brief Opciones que se mandan al servidor, las que cambian el ejecutable
+ */
+#define OPCIONES_PETICION 6
+
+/**
+ * @brief Resultado de una peticion
+ */
+typedef enum {
+    RESPUESTA_LISTA, /**< Se compilo, despues de la respuesta va el ejecutable */
+    RESPUESTA_VACIO, /**< El programa no tiene tokens */
+    RESPUESTA_INCORRECTO, /**< Error del parser en la linea y columna de la respuesta */
+    RESPUESTA_GCC, /**< gcc no pudo compilar el programa traducido */
+    RESPUESTA_FALLA /**< La peticion no es valida o el servidor no pudo guardar el ejecutable */
+} EstadoRespuesta;
+
+/**
+ * @brief Encabezado de una peticion, despues van el nombre y el texto del programa
+ */
+typedef struct {
+    uint32_t magia; /**< MAGIA_SERVIDOR */
+    int32_t opciones[OPCIONES_PETICION]; /**< numero, checked, ordenamientos, paralelo, perfil y depuracion */
+    uint32_t tamNombre; /**< Tamaño del nombre del archivo */
+    uint64_t tamFuente; /**< Tamaño del texto del programa */
+} Peticion;
+
+/**
+ * @brief Encabezado de una respuesta
+ */
+typedef struct {
+    int32_t estado; /**< EstadoRespuesta */
+    int32_t linea; /**< Linea del error del parser */
+    int32_t columna; /**< Columna del error del parser */
+    uint64_t tamEjecutable; /**< Tamaño del ejecutable que sigue, 0 si no se compilo */
+} Respuesta;
+
+/**
+ * @brief Estado que comparten los hilos del servidor
+ */
+typedef struct {
+    int socket; /**< Socket donde se aceptan las conexiones */
+    char carpeta[256]; /**< Carpeta temporal con los ejecutables ya compilados y los Listas.o */
+    int listas[3][2]; /**< Listas.o de cada tipo de numero, sin y con -g: 0 sin compilar, 1 listo, -1 fallo */
+    pthread_mutex_t candado; /**< Protege listas mientras se compila un Listas.o */
+    long siguiente; /**< Numero para los nombres temporales de cada compilacion */
+} Servidor;
+
+/**
+ * @defgroup funciones_servidor Funciones del servidor de compilacion
+ * @{
+ */
+int servidor(const char* ruta, int hilos);
+void* atenderServidor(void* argumento);
+void atenderPeticion(Servidor* srv, int conexion);
+const char* listasServidor(Servidor* srv, Opciones* opciones, char* objeto, int tam);
+int compilarRemoto(Contexto* ctx);
+int conectar(const char* ruta);
+int escribirTodo(int fd, const void* datos, size_t tam);
+int leerTodo(int fd, void* datos, size_t tam);
+/** @} */
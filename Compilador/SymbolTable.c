@@ -28,7 +28,7 @@ Variable* setVariable(char* nombre)
 	var->nombre = strdup(nombre);
 	var->next = NULL;
 	var->token.tipoToken = (char*)calloc(sizeof(char),10);
-	var->token.cadena = (char*)calloc(sizeof(char),20);
+	var->token.cadena = (char*)calloc(sizeof(char),TAM_VALOR);
 
 	return var;
 }
@@ -164,7 +164,8 @@ Token* regresar(HashMap* hashmap, char* nombre)
  * @brief Asignar valor
  * @ingroup funciones_hashtable
  * 
- * Método que asigna un valor a una variable ya declarada
+ * Método que asigna un valor a una variable ya declarada.
+ * Las listas siempre se quedan como listas aunque se les agregue una expresion.
  * 
  * @param hashmap Tabla hash donde se buscará la variable
  * @param nombre Variable a buscar y la cual se le añadirá el valor
@@ -183,18 +184,21 @@ int asignarValorHash(HashMap* hashmap, char* nombre, Token token)
 	{
 		if(!strcmp(bucketHead->nombre,nombre))
 		{
-			if(!strcmp(token.tipoToken,"FLOAT") || !strcmp(token.tipoToken,"NUM"))
+			if(!strcmp(bucketHead->token.tipoToken,"LISTA"))
+				;
+			else if(!strcmp(token.tipoToken,"FLOAT") || !strcmp(token.tipoToken,"NUM"))
 				strcpy(bucketHead->token.tipoToken,"FLOAT");
 			else if(!strcmp(token.tipoToken,"STRING"))
 				strcpy(bucketHead->token.tipoToken,token.tipoToken);
 			else if(!strcmp(token.tipoToken,"LISTA"))
 				strcpy(bucketHead->token.tipoToken,token.tipoToken);
 			
-			char temp[50];
-			strcpy(temp,bucketHead->token.cadena);
-			strcat(temp,token.cadena);
-			strcpy(bucketHead->token.cadena,temp);
-			//strcat(bucketHead->token.cadena,token.cadena);
+			//El valor solo se usa para imprimir la tabla, se corta al tamaño reservado.
+			//Puede ser el mismo valor de la variable (x = x), por eso se copia con memmove
+			size_t usado = strlen(bucketHead->token.cadena);
+			size_t largo = strnlen(token.cadena,TAM_VALOR - 1 - usado);
+			memmove(bucketHead->token.cadena + usado,token.cadena,largo);
+			bucketHead->token.cadena[usado + largo] = '\0';
 
 			//printf("Valor %s asignado a %s\n",bucketHead->token.cadena,bucketHead->nombre);
 			return 1;
@@ -219,12 +223,8 @@ int asignarValorHash(HashMap* hashmap, char* nombre, Token token)
  */
 int declararLista(HashMap* hashmap, char* nombre)
 {
-	printf("Declarando %s\n",nombre);
 	if(buscar(hashmap,nombre))
-	{
-		printf("Lista ya declarada\n");
 		return 0;
-	}
 	insert(hashmap,nombre);
 	Token token;
 	token.tipoToken = "LISTA";
@@ -315,12 +315,10 @@ int intermedia(Pila *scopes, char* nombre, Token token, int declaracion)
 	if(declaracion == 1)
 	{
 		if(buscar(scopes->head->scope,nombre))
-		{
-			printf("Variable ya declarada\n");
 			return 0;
-		}
 		insert(scopes->head->scope,nombre);
 		//insert(copia.head->scope,nombre);
+		return 1;
 	}
 	else
 	{
@@ -549,7 +547,6 @@ int buscarPila(Pila* pila, char* nombre)
 		temp = temp->next;
 	}
 
-	printf("La variable %s no está declarada en este scope\n",nombre);
 	return 0;
 }
 
@@ -572,8 +569,6 @@ void borrarValor(Pila *pila, char* nombre)
 
 		temp = temp->next;
 	}
-
-	printf("La variable %s no está declarada en este scope\n",nombre);
 }
 
 /**
@@ -595,8 +590,6 @@ void asignarValor(Pila *pila, char* nombre,Token token)
 
 		temp = temp->next;
 	}
-
-	printf("La variable %s no está declarada en este scope\n",nombre);
 }
 
 /**
@@ -626,7 +619,6 @@ Token* regresarValor(Pila *pila, char* nombre)
 		temp = temp->next;
 	}
 
-	printf("La variable %s no está declarada en este scope\n",nombre);
 	return NULL;
 }
 
@@ -635,16 +627,18 @@ Token* regresarValor(Pila *pila, char* nombre)
  * @ingroup funciones_pila
  * 
  * Método que imprime la copia de la tabla de símbolos
+ *
+ * @param copia Copia de la tabla de símbolos de una compilación
  */
-void printTabla()
+void printTabla(Pila *copia)
 {
-	if(copia.head == NULL)
+	if(copia->head == NULL)
 	{
 		printf("La tabla esta vacia\n");
 		return;
 	}
 
-	NodoPila* actual = copia.head;
+	NodoPila* actual = copia->head;
 	int numHashMap = 1;
 
 	while(actual)
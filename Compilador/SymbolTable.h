@@ -11,6 +11,11 @@
 #pragma once
 #include "Lexer.h"
 
+/**
+ * @brief Caracteres que se guardan del valor de una variable, contando el fin de cadena
+ */
+#define TAM_VALOR 20
+
 /**
  * @brief Estructura que representa una variable
  */
@@ -47,7 +52,10 @@ typedef struct stack
 	NodoPila* head; /**< Scope actual */
 }Pila;
 
-extern Pila copia;
+/**
+ * @brief Estado de una compilacion(adelanto).
+ */
+typedef struct Contexto Contexto;
 
 /**
  * @defgroup funciones_pila Funciones de la tabla de símbolos
@@ -64,7 +72,7 @@ void vaciarPilaCompleto(Pila *pila);
 void borrarValor(Pila *pila, char* nombre);
 void asignarValor(Pila *pila, char* nombre, Token token);
 Token* regresarValor(Pila *pila, char* nombre);
-void printTabla();
+void printTabla(Pila *copia);
 int buscarPila(Pila* pila, char* nombre);
 int intermedia(Pila* scopes, char* nombre, Token token, int declaracion);
 //int peek(Pila *pila); //Aqui no va a regresar un int, sino una tabla hash
@@ -91,5 +99,5 @@ void borrarHash(HashMap* hashmap);
  * @defgroup funciones_compilador Funciones principales del compilador
  * @{
  */
-int parser(char *filename, Tokens *tokens);
+int parser(Contexto* ctx);
 /**@} */
\ No newline at end of file
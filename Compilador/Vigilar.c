@@ -0,0 +1,315 @@
+/**
+ * @file Vigilar.c
+ * @brief Implementación del modo --watch.
+ *
+ * Espera con inotify a que se guarde el archivo y lo vuelve a compilar. Solo se
+ * vuelven a revisar las lineas que cambiaron y los enunciados que las contienen,
+ * el codigo C se escribe en memoria y gcc solo se llama si ese codigo es distinto
+ * al de la compilacion anterior sin contar las directivas #line. Listas.c se
+ * compila una sola vez al empezar.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#include <sys/signalfd.h>
+#include "Vigilar.h"
+#include "Lote.h"
+#include "wwec.h"
+
+/**@cond */
+int eventoArchivo(char* eventos, ssize_t tam, const char* nombre);
+const char* saltarDirectivas(const char* p, const char* fin);
+int mismoCodigo(const char* a, size_t tamA, const char* b, size_t tamB);
+/**@endcond */
+
+/**
+ * @brief Vigilar
+ * @ingroup funciones_vigilar
+ *
+ * Compila el archivo y despues lo vuelve a compilar cada vez que cambia, hasta
+ * recibir SIGINT o SIGTERM.
+ *
+ * @param filename Archivo .wwe a vigilar
+ * @param archivo_salida Nombre del ejecutable
+ * @param opciones Opciones de todas las compilaciones
+ *
+ * @return int 0 si termino con una señal, 1 si no se pudo vigilar el archivo
+ */
+int vigilar(char* filename, char* archivo_salida, Opciones* opciones)
+{
+    Vigilancia v;
+    memset(&v,0,sizeof(Vigilancia));
+    v.filename = filename;
+    v.archivo_salida = archivo_salida;
+    v.opciones = *opciones;
+    v.opciones.servidor = NULL;
+    inicializarTokens(&v.tokens);
+    v.anterior = (Programa*)calloc(1,sizeof(Programa));
+
+    //Se vigila la carpeta porque muchos editores guardan en otro archivo y lo renombran
+    char carpeta[512];
+    const char* nombre = strrchr(filename,'/');
+    if(nombre)
+    {
+        snprintf(carpeta,sizeof(carpeta),"%.*s",(int)(nombre - filename),filename);
+        if(!carpeta[0])
+            strcpy(carpeta,"/");
+        nombre++;
+    }
+    else
+    {
+        strcpy(carpeta,".");
+        nombre = filename;
+    }
+
+    int cambios = inotify_init1(IN_CLOEXEC);
+    if(cambios < 0 || inotify_add_watch(cambios,carpeta,IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+    {
+        printf("No se puede vigilar %s: %s\n",carpeta,strerror(errno));
+        return 1;
+    }
+
+    //Las señales se leen como eventos para borrar Listas.o antes de salir
+    sigset_t senales;
+    sigemptyset(&senales);
+    sigaddset(&senales,SIGINT);
+    sigaddset(&senales,SIGTERM);
+    sigprocmask(SIG_BLOCK,&senales,NULL);
+    int terminar = signalfd(-1,&senales,SFD_CLOEXEC);
+
+    char objeto[64];
+    snprintf(objeto,sizeof(objeto),"wwe_listas_%ld.o",(long)getpid());
+    int listas = compilarListas(&v.opciones,objeto);
+
+    recompilar(&v,listas ? objeto : NULL);
+    printf("Esperando cambios en %s\n",filename);
+    fflush(stdout);
+
+    char eventos[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    struct pollfd esperas[2] = {{cambios,POLLIN,0},{terminar,POLLIN,0}};
+    while(1)
+    {
+        if(poll(esperas,2,-1) < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            break;
+        }
+        if(esperas[1].revents)
+            break;
+        if(!(esperas[0].revents & POLLIN))
+            continue;
+
+        ssize_t tam = read(cambios,eventos,sizeof(eventos));
+        if(tam <= 0 || !eventoArchivo(eventos,tam,nombre))
+            continue;
+
+        //Un guardado puede llegar en varios eventos seguidos, se espera a que terminen
+        struct pollfd espera = {cambios,POLLIN,0};
+        while(poll(&espera,1,50) > 0 && read(cambios,eventos,sizeof(eventos)) > 0);
+
+        if(recompilar(&v,listas ? objeto : NULL) >= 0)
+        {
+            printf("Esperando cambios en %s\n",filename);
+            fflush(stdout);
+        }
+    }
+
+    if(listas)
+        remove(objeto);
+    close(cambios);
+    close(terminar);
+    borrarLista(&v.tokens);
+    eliminarPrograma(v.anterior);
+    free(v.anterior);
+    free(v.fuente);
+    free(v.codigo);
+    return 0;
+}
+
+/**
+ * @brief Recompilar
+ * @ingroup funciones_vigilar
+ *
+ * Lee el archivo y si cambio lo vuelve a compilar con los tokens y los enunciados
+ * de la compilacion anterior. Con --time-report escribe el reporte de cada compilacion.
+ *
+ * @param v Estado del modo --watch
+ * @param listas Listas.o ya compilado, NULL para compilar Listas.c
+ *
+ * @return int 1 si el ejecutable esta al dia, 0 si hubo un error, -1 si el archivo no cambio
+ */
+int recompilar(Vigilancia* v, const char* listas)
+{
+    size_t tam;
+    char* fuente = leerArchivo(v->filename,&tam);
+    if(!fuente)
+    {
+        printf("No se pudo leer %s\n",v->filename);
+        return 0;
+    }
+
+    //Algunos editores escriben el archivo aunque no cambie
+    if(v->fuente && tam == v->tamFuente && !memcmp(fuente,v->fuente,tam))
+    {
+        free(fuente);
+        return -1;
+    }
+
+    Contexto ctx;
+    inicializarContexto(&ctx,v->filename,v->archivo_salida,&v->opciones);
+    ctx.fuente = fuente;
+    ctx.tamFuente = tam;
+    ctx.listas = listas;
+    ctx.anterior = v->anterior;
+
+    iniciarFase(&ctx.medicion);
+    int reutilizados = relexar(&v->tokens,v->fuente,v->tamFuente,fuente,tam,&ctx.edicion);
+    terminarFase(&ctx.medicion,FASE_LEXICO);
+
+    //Los tokens se prestan al contexto y se recuperan para la siguiente vez
+    ctx.tokens = v->tokens;
+    int correcto = construirPrograma(&ctx);
+    v->tokens = ctx.tokens;
+    inicializarTokens(&ctx.tokens);
+
+    //Si no se crearon los enunciados ya no corresponden al texto, la siguiente vez se crean todos
+    if(!correcto)
+        eliminarPrograma(v->anterior);
+    int res = correcto && compilarCodigo(v,&ctx);
+
+    free(v->fuente);
+    v->fuente = fuente;
+    v->tamFuente = tam;
+
+    if(res)
+    {
+        int enunciados = 0;
+        for(Enunciado* e = v->anterior->lista_enunciados; e != NULL; e = e->siguiente)
+            enunciados++;
+        printf("%s listo, %d de %d tokens y %d de %d enunciados reutilizados\n",v->archivo_salida,
+            reutilizados,v->tokens.cant,ctx.reutilizados,enunciados);
+    }
+    if(ctx.opciones.reporte)
+        imprimirMedicion(&ctx.medicion,stderr,ctx.opciones.reporte == REPORTE_JSON);
+
+    liberarContexto(&ctx);
+    return res;
+}
+
+/**
+ * @brief Compilar codigo
+ * @ingroup funciones_vigilar
+ *
+ * Traduce el programa del contexto en memoria y solo llama a gcc si el codigo C
+ * es distinto al de la ultima vez o si ya no esta el ejecutable. Las directivas
+ * #line no cuentan, asi un comentario o una linea en blanco que recorre las lineas
+ * no llama a gcc; con -g si cuentan porque gdb usa esas lineas.
+ *
+ * @param v Estado del modo --watch
+ * @param ctx Contexto con el programa ya construido
+ *
+ * @return int Si el ejecutable corresponde al programa
+ */
+int compilarCodigo(Vigilancia* v, Contexto* ctx)
+{
+    size_t tam;
+    const char* codigo = wwec_codigo(ctx,&tam);
+    if(!codigo)
+        return 0;
+
+    int igual = ctx->opciones.depuracion ? tam == v->tamCodigo && !memcmp(codigo,v->codigo,tam)
+        : mismoCodigo(codigo,tam,v->codigo,v->tamCodigo);
+    if(v->ejecutable && igual && access(v->archivo_salida,X_OK) == 0)
+    {
+        printf("El codigo C no cambio, no se llama a gcc\n");
+        return 1;
+    }
+
+    free(v->codigo);
+    v->codigo = ctx->codigo;
+    v->tamCodigo = tam;
+    ctx->codigo = NULL;
+
+    FILE* fptr = fopen(ctx->archivo_c,"w");
+    if(fptr == NULL)
+    {
+        printf("No se pudo crear %s: %s\n",ctx->archivo_c,strerror(errno));
+        return v->ejecutable = 0;
+    }
+    fwrite(v->codigo,1,tam,fptr);
+    fclose(fptr);
+
+    v->ejecutable = ejecutarGcc(ctx);
+    remove(ctx->archivo_c);
+    if(!v->ejecutable)
+        printf("Error al compilar\n");
+    return v->ejecutable;
+}
+
+/**@cond */
+
+/*
+ * Busca entre los eventos de inotify uno del archivo vigilado
+ */
+int eventoArchivo(char* eventos, ssize_t tam, const char* nombre)
+{
+    for(char* p = eventos; p < eventos + tam; )
+    {
+        struct inotify_event* evento = (struct inotify_event*)p;
+        if(evento->len && !strcmp(evento->name,nombre))
+            return 1;
+        p += sizeof(struct inotify_event) + evento->len;
+    }
+    return 0;
+}
+
+/*
+ * Regresa donde empieza la siguiente linea que no es una directiva #line
+ */
+const char* saltarDirectivas(const char* p, const char* fin)
+{
+    while(fin - p >= 6 && !memcmp(p,"#line ",6))
+    {
+        const char* salto = (const char*)memchr(p,'\n',fin - p);
+        p = salto ? salto + 1 : fin;
+    }
+    return p;
+}
+
+/*
+ * Compara dos codigos C linea por linea sin contar las directivas #line
+ */
+int mismoCodigo(const char* a, size_t tamA, const char* b, size_t tamB)
+{
+    if(!a || !b)
+        return 0;
+
+    const char* finA = a + tamA;
+    const char* finB = b + tamB;
+    while(1)
+    {
+        a = saltarDirectivas(a,finA);
+        b = saltarDirectivas(b,finB);
+        if(a == finA || b == finB)
+            return a == finA && b == finB;
+
+        const char* saltoA = (const char*)memchr(a,'\n',finA - a);
+        const char* saltoB = (const char*)memchr(b,'\n',finB - b);
+        size_t largoA = saltoA ? saltoA + 1 - a : finA - a;
+        size_t largoB = saltoB ? saltoB + 1 - b : finB - b;
+        if(largoA != largoB || memcmp(a,b,largoA))
+            return 0;
+        a += largoA;
+        b += largoB;
+    }
+}
+
+/**@endcond */
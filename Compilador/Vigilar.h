@@ -0,0 +1,37 @@
+/**
+ * @file Vigilar.h
+ * @brief Prototipos y estructuras del modo --watch.
+ *
+ * Este archivo contiene lo necesario para vigilar un archivo .wwe y volver a
+ * compilarlo cada vez que se guarda, reutilizando lo que no cambio.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+#include "Contexto.h"
+
+/**
+ * @brief Lo que se guarda entre una compilacion y la siguiente
+ */
+typedef struct {
+    char* filename; /**< Archivo .wwe vigilado */
+    char* archivo_salida; /**< Ejecutable que se crea */
+    Opciones opciones; /**< Opciones de todas las compilaciones */
+    char* fuente; /**< Texto de la ultima compilacion */
+    size_t tamFuente; /**< Tamaño de fuente */
+    Tokens tokens; /**< Tokens de fuente */
+    Programa* anterior; /**< Enunciados sin optimizar de fuente, vacio si no se pudieron crear */
+    char* codigo; /**< Codigo C que se le dio a gcc la ultima vez */
+    size_t tamCodigo; /**< Tamaño de codigo */
+    int ejecutable; /**< Booleano para saber si gcc creo el ejecutable con codigo */
+} Vigilancia;
+
+/**
+ * @defgroup funciones_vigilar Funciones del modo --watch
+ * @{
+ */
+int vigilar(char* filename, char* archivo_salida, Opciones* opciones);
+int recompilar(Vigilancia* v, const char* listas);
+int compilarCodigo(Vigilancia* v, Contexto* ctx);
+/** @} */
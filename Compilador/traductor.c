@@ -1,123 +1,57 @@
-/**
- * @mainpage Compilador-Traductor de Lenguaje WWE
- * 
- * Este proyecto implementa un traductor para un lenguaje propio
- * a c, para despues realizar la compilación y regresar un ejectuable,
- * funcionando como cualquier compilador
- * 
- * ##Contenido principal
- * -Analis léxico
- * -Parser/Análisis semántico
- * -Creación de enunciados
- * -Traduccion
- * -Compilacion de archivo y retorno de ejecutable
- * 
- * ##Autores
- * -Alexander Arellano Odabachea
- * 
- * @author Alexander Arellano Odabachea
- */
 /**
  * @file traductor.c
  * @brief Funciones de la escritura a archivo
  * 
  * @author Alexander Arellano Odabachea
  */
+#include <stdlib.h>
 #include "SymbolTable.h"
 #include "Enunciados.h"
-
-void traductor(Programa *programa,FILE *fptr);
+#include "Optimizador.h"
+#include "Rangos.h"
+#include "Paralelo.h"
+#include "Contexto.h"
 
 /**
  * @defgroup funciones_escritura Funciones de escritura a archivo
  * @{
  */
-void escribirPrograma(Programa* programa, FILE* fptr);
-void escribirValor(Valor val,FILE *fptr);
+void escribirPrograma(Contexto* ctx, Programa* programa, FILE* fptr);
+void escribirValor(Contexto* ctx, Valor val,FILE *fptr);
 void escribirOperador(OPRelacional val,FILE *fptr);
-void escribirExpresion(Expresion* expr,FILE *fptr);
-void escribirEnunciado(Enunciado* e, FILE *fptr);
+void escribirExpresion(Contexto* ctx, Expresion* expr,FILE *fptr);
+void escribirEnunciado(Contexto* ctx, Enunciado* e, FILE *fptr);
+void escribirNumero(double numero, FILE *fptr);
+void escribirContado(Contexto* ctx, Mientras* m, int linea, FILE *fptr);
+void escribirMarca(Contexto* ctx, int linea, FILE *fptr);
+void escribirLinea(Contexto* ctx, int linea, FILE *fptr);
+void escribirCadena(const char* cadena, FILE *fptr);
+int escribirFuente(Contexto* ctx, FILE *fptr);
 /**@}*/
 
-int main(int argc, char *argv[])
-{
-	Tokens tokens;
-	inicializarTokens(&tokens);
-
-	if(argc != 4 || strcmp(argv[2],"-o") != 0)
-	{
-		printf("No ingreso el nombre del archivo\n");
-		return 0;
-	}
-
-	char* filename = argv[1];
-	char* archivo_salida = argv[3];
-	char archivo_c[256];
-	snprintf(archivo_c,sizeof(archivo_c), "%s_temp.c",archivo_salida);
-
-	lexerAnalysis(filename,&tokens);
-
-	if(!parser(filename,&tokens))
-	{
-		printf("El programa no esta correcto\n");
-		vaciarPilaCompleto(&copia);
-		borrarLista(&tokens);
-		return 0;
-	}
-	
-	//printTabla();
-	
-	Programa *programa = (Programa*)calloc(1,sizeof(Programa));
-	programa->lista_enunciados = NULL;
-	programa->ultimo_enunciado = NULL;
-	
-	tokens.actual = tokens.inicio;
-	
-	crearEnunciados(programa,&tokens);
-	//imprimirPrograma(programa);
-
-	FILE *fptr = fopen(archivo_c,"w");
-	traductor(programa,fptr);
-
-
-	char comando_gcc[512];
-	snprintf(comando_gcc,sizeof(comando_gcc),"gcc %s Listas.c -o %s",archivo_c,archivo_salida);
-
-	int res = system(comando_gcc);
-	if(res != 0)
-	{
-		printf("Error al compilar\n");
-		vaciarPilaCompleto(&copia);
-		borrarLista(&tokens);
-		eliminarPrograma(programa);
-		free(programa);
-		remove(archivo_c);
-		return 0;
-	}
-
-	remove(archivo_c);
-	vaciarPilaCompleto(&copia);
-	borrarLista(&tokens);
-	eliminarPrograma(programa);
-	free(programa);
-	return 0;
-}
-
 /**
  * @brief Traductor
  * @ingroup funciones_compilador
  * 
  * Método que se encarga de escribir en un archivo nuevo lo esencial para el archivo .c
  * 
- * @param programa Lista de enunciados completa
+ * @param ctx Contexto de la compilacion con la lista de enunciados completa
  * @param fptr Apuntador al archivo nuevo a escribir
  */
-void traductor(Programa* programa,FILE *fptr)
+void traductor(Contexto* ctx, FILE *fptr)
 {
 	fprintf(fptr,"#include \"Listas.h\"\n\n");
+	//Con --profile el archivo .wwe se copia al programa para el reporte
+	int lineas = ctx->opciones.perfil ? escribirFuente(ctx,fptr) : 0;
 	fprintf(fptr,"int main(){\n");
+	if(ctx->opciones.perfil) {
+		fprintf(fptr,"iniciarPerfil(");
+		escribirCadena(ctx->filename,fptr);
+		fprintf(fptr,",_wwe_fuente,%d);\n",lineas);
+	}
 
-	escribirPrograma(programa,fptr);
+	escribirPrograma(ctx,ctx->programa,fptr);
+	fprintf(fptr,"vaciarSalida();\n");
 	fprintf(fptr,"return 0;\n}\n");
 	fclose(fptr);
 }
@@ -128,15 +62,26 @@ void traductor(Programa* programa,FILE *fptr)
  * 
  * Método que compara el tipo de enunciado actual y escribe lo necesario en el archivo .c
  * 
+ * @param ctx Contexto de la compilacion
  * @param e Enunciado a revisar
  * @param fptr Apuntador al archivo nuevo a escribir
  */
-void escribirEnunciado(Enunciado* e, FILE *fptr) {
+void escribirEnunciado(Contexto* ctx, Enunciado* e, FILE *fptr) {
+	int ultima = 0;
     while (e != NULL) {
+		//Varios enunciados de la misma linea llevan una sola marca, la del ciclo va despues de su previo
+		if(e->linea != ultima && e->tipo != ENUNC_MIENTRAS) {
+			escribirLinea(ctx,e->linea,fptr);
+			escribirMarca(ctx,e->linea,fptr);
+		}
+		ultima = e->linea;
         switch (e->tipo) {
             case ENUNC_DECLARACION:
 			    for (int i = 0; i < e->declaracion.cantidad; i++) {
-					fprintf(fptr,"float %s;\n",e->declaracion.variables[i]);
+					if(e->declaracion.enteros && e->declaracion.enteros[i])
+						fprintf(fptr,"int64_t %s;\n",e->declaracion.variables[i]);
+					else
+						fprintf(fptr,"Numero %s;\n",e->declaracion.variables[i]);
                 }
                 break;
             case ENUNC_DECLARACION_LISTA:
@@ -149,59 +94,117 @@ void escribirEnunciado(Enunciado* e, FILE *fptr) {
 
             case ENUNC_ASIGNACION:
 				//fprintf(fptr,"%s = ",e->asignacion.variable);
-				escribirValor(e->asignacion.variable,fptr);
+				escribirValor(ctx,e->asignacion.variable,fptr);
 				fprintf(fptr," = ");
-				escribirExpresion(e->asignacion.expresion,fptr);
+				escribirExpresion(ctx,e->asignacion.expresion,fptr);
 				fprintf(fptr,";\n");
 				break;
             case ENUNC_ASIGNACION_LISTA:
 				fprintf(fptr,"pushLista(&%s,",e->asignacion.variable.nombre);
-                escribirExpresion(e->asignacion.expresion,fptr);
+                escribirExpresion(ctx,e->asignacion.expresion,fptr);
 				fprintf(fptr,");\n");
                 break;
 
             case ENUNC_LEER:
-				fprintf(fptr,"scanf(\"%%f\",&%s);\n",e->leer.variable);
+				fprintf(fptr,"leerNumero(&%s);\n",e->leer.variable);
                 break;
             case ENUNC_LEER_LISTA:
-				fprintf(fptr,"float temp;\n");
-				fprintf(fptr,"scanf(\"%%f\",&temp);\n");
-				fprintf(fptr,"pushLista(&%s,temp);\n",e->leer.variable);
+				fprintf(fptr,"leerEnLista(&%s);\n",e->leer.variable);
+                break;
+            case ENUNC_LEER_TODO:
+				fprintf(fptr,"leerTodo(&%s);\n",e->leer.variable);
                 break;
             case ENUNC_ANUNCIAR:
                 if (e->anunciar.esCadena) {
-					fprintf(fptr,"printf(%s);\n",e->anunciar.cadena);
+					//La cadena se copia tal cual a la salida, sin formato
+					fprintf(fptr,"anunciarCadena(%s,sizeof(%s) - 1);\n",e->anunciar.cadena,e->anunciar.cadena);
                 } else {
-					fprintf(fptr,"printf(\"%%.2f\",");
-                    escribirExpresion(e->anunciar.expresion,fptr);
-					fprintf(fptr,");\n");
+					//Los enteros se imprimen exactos con el mismo formato de dos decimales
+					if(ctx->opciones.numero == NUM_INT64 || expresionEntera(e->anunciar.expresion,NULL)) {
+						fprintf(fptr,"anunciarEntero((int64_t)(");
+						escribirExpresion(ctx,e->anunciar.expresion,fptr);
+						fprintf(fptr,"));\n");
+					} else {
+						fprintf(fptr,"anunciarNumero(");
+						escribirExpresion(ctx,e->anunciar.expresion,fptr);
+						fprintf(fptr,");\n");
+					}
                 }
                 break;
 
+            case ENUNC_ANUNCIAR_LISTA:
+				fprintf(fptr,"anunciarLista(&%s,%s,sizeof(%s) - 1);\n",e->anunciarLista.lista,e->anunciarLista.separador,e->anunciarLista.separador);
+                break;
+
+            case ENUNC_GUARDAR_LISTA:
+				fprintf(fptr,"guardarLista(&%s,%s);\n",e->archivo.lista,e->archivo.archivo);
+                break;
+            case ENUNC_CARGAR_LISTA:
+				fprintf(fptr,"cargarLista(&%s,%s);\n",e->archivo.lista,e->archivo.archivo);
+                break;
+
             case ENUNC_SI:
 				fprintf(fptr,"if(");
-                escribirValor(e->si.comp.izquierda,fptr);
+                escribirValor(ctx,e->si.comp.izquierda,fptr);
 				escribirOperador(e->si.comp.operador,fptr);
-                escribirValor(e->si.comp.derecha,fptr);
+                escribirValor(ctx,e->si.comp.derecha,fptr);
 				fprintf(fptr,"){\n");
-                escribirPrograma(e->si.entonces,fptr);
+                escribirPrograma(ctx,e->si.entonces,fptr);
                 if(e->si.si_no) {
 					fprintf(fptr,"}else{\n");
-                    escribirPrograma(e->si.si_no,fptr);
+                    escribirPrograma(ctx,e->si.si_no,fptr);
                 }
 				fprintf(fptr,"}\n");
                 break;
 
             case ENUNC_MIENTRAS:
+				if(e->mientras.previo)
+					escribirEnunciado(ctx,e->mientras.previo->lista_enunciados,fptr);
+				escribirLinea(ctx,e->linea,fptr);
+				escribirMarca(ctx,e->linea,fptr);
+				if(e->mientras.contador) {
+					escribirContado(ctx,&e->mientras,e->linea,fptr);
+					break;
+				}
 				fprintf(fptr,"while(");
-                escribirValor(e->mientras.comp.izquierda,fptr);
+                escribirValor(ctx,e->mientras.comp.izquierda,fptr);
 				escribirOperador(e->mientras.comp.operador,fptr);
-                escribirValor(e->mientras.comp.derecha,fptr);
+                escribirValor(ctx,e->mientras.comp.derecha,fptr);
 				fprintf(fptr,"){\n");
-                escribirPrograma(e->mientras.cuerpo,fptr);
+				escribirMarca(ctx,e->linea,fptr);
+                escribirPrograma(ctx,e->mientras.cuerpo,fptr);
 				fprintf(fptr,"}\n");
                 break;
 
+            case ENUNC_ORDENAR:
+				if(e->ordenar.parcial) {
+					fprintf(fptr,"ordenarListaHasta(&%s,(double)(",e->ordenar.lista);
+					escribirValor(ctx,e->ordenar.hasta,fptr);
+					fprintf(fptr,"));\n");
+				} else
+					fprintf(fptr,"ordenarLista(&%s);\n",e->ordenar.lista);
+                break;
+
+            case ENUNC_OPERAR_LISTA:
+				//La resta es sumar el negativo, en C da exactamente lo mismo
+				if(!strcmp(e->operar.operador,"*"))
+					fprintf(fptr,"multiplicarEscalar(&%s,(Numero)(",e->operar.lista);
+				else if(!strcmp(e->operar.operador,"/"))
+					fprintf(fptr,"dividirEscalar(&%s,(Numero)(",e->operar.lista);
+				else
+					fprintf(fptr,"sumarEscalar(&%s,%s(Numero)(",e->operar.lista,strcmp(e->operar.operador,"-") ? "" : "-");
+				escribirExpresion(ctx,e->operar.expresion,fptr);
+				fprintf(fptr,"));\n");
+                break;
+
+            case ENUNC_RESERVAR_LISTA:
+				fprintf(fptr,"reservarAdicional(&%s,((long)(",e->reservar.lista);
+				escribirValor(ctx,e->reservar.hasta,fptr);
+				fprintf(fptr,") - (long)(");
+				escribirValor(ctx,e->reservar.desde,fptr);
+				fprintf(fptr,") + 1) * %d);\n",e->reservar.porVuelta);
+                break;
+
             default:
                 printf("Enunciado no reconocido.\n");
                 break;
@@ -216,24 +219,30 @@ void escribirEnunciado(Enunciado* e, FILE *fptr) {
  * 
  * Método que compara el tipo de expresión actual y escribe lo necesario en el archivo .c
  * 
+ * @param ctx Contexto de la compilacion
  * @param expr Expresión a revisar
  * @param fptr Apuntador al archivo nuevo a escribir
  */
-void escribirExpresion(Expresion* expr,FILE *fptr) {
+void escribirExpresion(Contexto* ctx, Expresion* expr,FILE *fptr) {
     if (!expr) return;
     if (expr->tipo == EXPR_VALOR) {
-        escribirValor(expr->valor,fptr);
+        escribirValor(ctx,expr->valor,fptr);
     } else if (expr->tipo == EXPR_BINARIA) {
-    	if(!strcmp(expr->binaria.oparitmetico,"%"))
-		fprintf(fptr,"(int)(");
-        escribirExpresion(expr->binaria.izquierda,fptr);
-    	if(!strcmp(expr->binaria.oparitmetico,"%"))
+    	int modulo = !strcmp(expr->binaria.oparitmetico,"%");
+    	//Los operandos enteros no necesitan conversion para el modulo
+    	if(modulo)
+		fprintf(fptr,expresionEntera(expr->binaria.izquierda,NULL) ? "(" : "(int64_t)(");
+    	//Si los dos lados son enteros la division tiene que seguir siendo flotante
+    	else if(!strcmp(expr->binaria.oparitmetico,"/") && expresionEntera(expr->binaria.izquierda,NULL))
+		fprintf(fptr,"(Numero)");
+        escribirExpresion(ctx,expr->binaria.izquierda,fptr);
+    	if(modulo)
 		fprintf(fptr,")");
         fprintf(fptr," %s ", expr->binaria.oparitmetico);
-    	if(!strcmp(expr->binaria.oparitmetico,"%"))
-		fprintf(fptr,"(int)(");
-        escribirExpresion(expr->binaria.derecha,fptr);
-    	if(!strcmp(expr->binaria.oparitmetico,"%"))
+    	if(modulo)
+		fprintf(fptr,expresionEntera(expr->binaria.derecha,NULL) ? "(" : "(int64_t)(");
+        escribirExpresion(ctx,expr->binaria.derecha,fptr);
+    	if(modulo)
 		fprintf(fptr,")");
     }
 }
@@ -244,22 +253,39 @@ void escribirExpresion(Expresion* expr,FILE *fptr) {
  * 
  * Método que compara el tipo de valor actual y escribe lo necesario en el archivo .c
  * 
+ * @param ctx Contexto de la compilacion
  * @param val Valor a revisar
  * @param fptr Apuntador al archivo nuevo a escribir
  */
-void escribirValor(Valor val,FILE *fptr) {
+void escribirValor(Contexto* ctx, Valor val,FILE *fptr) {
         switch (val.tipo) {
             case VAL_VARIABLE:
                 fprintf(fptr,"%s", val.nombre);
                 break;
             case VAL_NUMERO:
-                fprintf(fptr,"%.2f", val.numero);
+                escribirNumero(val.numero,fptr);
                 break;
             case VAL_LISTA_INDEX:
-                fprintf(fptr,"%s.arr[%d]", val.nombre, val.indice);
+                if(contieneConjunto(&ctx->arreglosLocales,val.nombre))
+                    fprintf(fptr,"_wwe_arr_%s", val.nombre);
+                else
+                    fprintf(fptr,"%s.arr", val.nombre);
+                if(ctx->opciones.checked && !val.seguro)
+                    fprintf(fptr,"[indiceChecado(&%s,%d)]", val.nombre, val.indice);
+                else
+                    fprintf(fptr,"[%d]", val.indice);
                 break;
 			case VAL_LISTA_INDEX_VAR:
-				fprintf(fptr,"%s.arr[(int)%s]",val.nombre,val.var);
+				if(contieneConjunto(&ctx->arreglosLocales,val.nombre))
+					fprintf(fptr,"_wwe_arr_%s",val.nombre);
+				else
+					fprintf(fptr,"%s.arr",val.nombre);
+				if(ctx->opciones.checked && !val.seguro)
+					fprintf(fptr,"[indiceChecado(&%s,%s)]",val.nombre,val.var);
+				else if(val.entero)
+					fprintf(fptr,"[%s]",val.var);
+				else
+					fprintf(fptr,"[(long)%s]",val.var);
 				break;
             case VAL_LISTA_F:
                 fprintf(fptr,"getPrimero(&%s)",val.nombre);
@@ -268,7 +294,22 @@ void escribirValor(Valor val,FILE *fptr) {
                 fprintf(fptr,"getUltimo(&%s)",val.nombre);
                 break;
             case VAL_LISTA_S:
-                fprintf(fptr,"getSize(&%s)",val.nombre);
+                if(contieneConjunto(&ctx->arreglosLocales,val.nombre))
+                    fprintf(fptr,"_wwe_tam_%s",val.nombre);
+                else
+                    fprintf(fptr,"getSize(&%s)",val.nombre);
+                break;
+            case VAL_LISTA_T:
+                fprintf(fptr,"sumaLista(&%s)",val.nombre);
+                break;
+            case VAL_LISTA_N:
+                fprintf(fptr,"minimoLista(&%s)",val.nombre);
+                break;
+            case VAL_LISTA_X:
+                fprintf(fptr,"maximoLista(&%s)",val.nombre);
+                break;
+            case VAL_LISTA_P:
+                fprintf(fptr,"productoPunto(&%s,&%s)",val.nombre,val.var);
                 break;
             default:
                 printf("Valor desconocido");
@@ -315,17 +356,222 @@ void escribirOperador(OPRelacional val,FILE *fptr) {
  * 
  * Método que va mandando enunciado por enunciado y escribe los free necesarios al finalizar las listas.
  * 
+ * @param ctx Contexto de la compilacion
  * @param programa Lista de enunciados completa
  * @param fptr Apuntador al archivo nuevo a escribir
  */
-void escribirPrograma(Programa* programa, FILE* fptr) {
+void escribirPrograma(Contexto* ctx, Programa* programa, FILE* fptr) {
     //printf("== Programa ==\n");
-    escribirEnunciado(programa->lista_enunciados,fptr);
+    escribirEnunciado(ctx,programa->lista_enunciados,fptr);
 
 	if(programa->listas){
 		for(int i = 0; i < programa->cantidad;i++)
 		{
-			fprintf(fptr,"free(%s.arr);\n",programa->variables[i]);
+			fprintf(fptr,"liberarLista(&%s);\n",programa->variables[i]);
 		}
 	}
 }
+
+/**
+ * @brief Escribir numero
+ * @ingroup funciones_escritura
+ *
+ * Escribe una constante sin perder precision, los enteros se escriben sin decimales
+ * para que no conviertan la expresion a flotante.
+ *
+ * @param numero Numero a escribir
+ * @param fptr Apuntador al archivo nuevo a escribir
+ */
+void escribirNumero(double numero, FILE *fptr) {
+	Valor val = {0};
+	val.tipo = VAL_NUMERO;
+	val.numero = numero;
+
+	if(valorEntero(val,NULL))
+		fprintf(fptr,"%.0f",numero);
+	else
+		fprintf(fptr,"%.17g",numero);
+}
+
+
+/**
+ * @brief Escribir contado
+ * @ingroup funciones_escritura
+ *
+ * Escribe un ciclo contado con la forma que gcc sabe vectorizar: el limite se convierte
+ * a un entero antes del ciclo si no cambia, las listas que solo se usan por indice se
+ * leen desde apuntadores restrict locales y los ciclos independientes llevan #pragma GCC ivdep.
+ * Si el ciclo se hace en paralelo lleva el pragma de OpenMP, que necesita el mismo limite
+ * entero; el contador se guarda con lastprivate para que el inductor quede igual.
+ *
+ * @param ctx Contexto de la compilacion
+ * @param m Ciclo a escribir
+ * @param linea Linea del ciclo en el archivo .wwe, para la marca de cada vuelta
+ * @param fptr Apuntador al archivo nuevo a escribir
+ */
+void escribirContado(Contexto* ctx, Mientras* m, int linea, FILE *fptr) {
+	int incluye = m->comp.operador == OP_MENOR_IGUAL || m->comp.operador == OP_MAYOR_IGUAL;
+	Conjunto nuevos = {0};
+
+	fprintf(fptr,"long %s;\n",m->contador);
+	for(int i = 0; i < m->cantidadArreglos; i++) {
+		char* lista = m->arreglos[i];
+		if(contieneConjunto(&ctx->arreglosLocales,lista))
+			continue;
+		if(!nuevos.cantidad)
+			fprintf(fptr,"{\n");
+		fprintf(fptr,"Numero* restrict _wwe_arr_%s = %s.arr;\n",lista,lista);
+		fprintf(fptr,"long _wwe_tam_%s = %s.ultimo;\n",lista,lista);
+		agregarConjunto(&nuevos,lista);
+	}
+	for(int i = 0; i < nuevos.cantidad; i++)
+		agregarConjunto(&ctx->arreglosLocales,nuevos.nombres[i]);
+
+	if(m->limiteFijo) {
+		Valor limite = m->comp.derecha;
+		fprintf(fptr,"long %s_fin = ",m->contador);
+		if(valorEntero(limite,NULL) || (ctx->opciones.numero == NUM_INT64 && limite.tipo != VAL_NUMERO)) {
+			fprintf(fptr,"(long)(");
+			escribirValor(ctx,limite,fptr);
+			fprintf(fptr,")%s;\n",incluye ? (m->paso > 0 ? " + 1" : " - 1") : "");
+		} else {
+			fprintf(fptr,"%s((double)(",m->paso > 0 ? "limiteArriba" : "limiteAbajo");
+			escribirValor(ctx,limite,fptr);
+			fprintf(fptr,"),%d);\n",incluye);
+		}
+	}
+
+	if(m->paralelo) {
+		fprintf(fptr,"%s = (long)%s;\n",m->contador,m->inductor);
+		if(m->paso > 0)
+			fprintf(fptr,"#pragma omp parallel for lastprivate(%s)%s if(%s_fin - %s > %d)\n",m->contador,m->paralelo,m->contador,m->contador,VUELTAS_PARALELO);
+		else
+			fprintf(fptr,"#pragma omp parallel for lastprivate(%s)%s if(%s - %s_fin > %d)\n",m->contador,m->paralelo,m->contador,m->contador,VUELTAS_PARALELO);
+	} else if(m->independiente)
+		fprintf(fptr,"#pragma GCC ivdep\n");
+
+	fprintf(fptr,"for(%s = (long)%s; ",m->contador,m->inductor);
+	if(m->limiteFijo)
+		fprintf(fptr,"%s %s %s_fin",m->contador,m->paso > 0 ? "<" : ">",m->contador);
+	else {
+		escribirValor(ctx,m->comp.izquierda,fptr);
+		escribirOperador(m->comp.operador,fptr);
+		escribirValor(ctx,m->comp.derecha,fptr);
+	}
+	fprintf(fptr,"; %s%s){\n",m->contador,m->paso > 0 ? "++" : "--");
+	if(m->paralelo)
+		ctx->perfilApagado++;
+	escribirMarca(ctx,linea,fptr);
+	escribirPrograma(ctx,m->cuerpo,fptr);
+	if(m->paralelo)
+		ctx->perfilApagado--;
+	fprintf(fptr,"}\n");
+
+	if(nuevos.cantidad)
+		fprintf(fptr,"}\n");
+	for(int i = 0; i < nuevos.cantidad; i++)
+		quitarConjunto(&ctx->arreglosLocales,nuevos.nombres[i]);
+	liberarConjunto(&nuevos);
+
+	fprintf(fptr,"%s = %s;\n",m->inductor,m->contador);
+}
+
+/**
+ * @brief Escribir marca
+ * @ingroup funciones_escritura
+ *
+ * Con --profile escribe la marca que cuenta la linea y le da el tiempo transcurrido a la
+ * linea anterior. En los ciclos se escribe antes del ciclo y al inicio de cada vuelta,
+ * asi la linea cuenta las veces que se reviso la condicion. Los enunciados que creo el
+ * optimizador no tienen linea y su tiempo queda en la linea anterior.
+ *
+ * @param ctx Contexto de la compilacion
+ * @param linea Linea del archivo .wwe
+ * @param fptr Apuntador al archivo nuevo a escribir
+ */
+void escribirMarca(Contexto* ctx, int linea, FILE *fptr) {
+	if(ctx->opciones.perfil && linea > 0 && !ctx->perfilApagado)
+		fprintf(fptr,"perfilLinea(%d);\n",linea);
+}
+
+/**
+ * @brief Escribir linea
+ * @ingroup funciones_escritura
+ *
+ * Escribe la directiva #line con la linea del enunciado en el archivo .wwe, asi los
+ * errores de gcc, gdb y los perfiladores como perf muestran la linea del programa WWE
+ * en vez de la del archivo .c, que se borra al terminar.
+ *
+ * @param ctx Contexto de la compilacion
+ * @param linea Linea del archivo .wwe, 0 si el enunciado lo creo el optimizador
+ * @param fptr Apuntador al archivo nuevo a escribir
+ */
+void escribirLinea(Contexto* ctx, int linea, FILE *fptr) {
+	if(linea <= 0)
+		return;
+	fprintf(fptr,"#line %d ",linea);
+	escribirCadena(ctx->filename,fptr);
+	fprintf(fptr,"\n");
+}
+
+/**
+ * @brief Escribir cadena
+ * @ingroup funciones_escritura
+ *
+ * Escribe un texto como cadena de C, con las diagonales invertidas de las rutas de Windows
+ * y las comillas escapadas.
+ *
+ * @param cadena Texto a escribir
+ * @param fptr Apuntador al archivo nuevo a escribir
+ */
+void escribirCadena(const char* cadena, FILE *fptr) {
+	fputc('"',fptr);
+	for(; *cadena; cadena++) {
+		if(*cadena == '"' || *cadena == '\\')
+			fputc('\\',fptr);
+		fputc(*cadena,fptr);
+	}
+	fputc('"',fptr);
+}
+
+/**
+ * @brief Escribir fuente
+ * @ingroup funciones_escritura
+ *
+ * Copia las lineas del archivo .wwe a un arreglo de cadenas del programa traducido,
+ * para que el reporte de --profile muestre el codigo de cada linea.
+ *
+ * @param ctx Contexto de la compilacion con el archivo o el texto del programa
+ * @param fptr Apuntador al archivo nuevo a escribir
+ *
+ * @return int Cantidad de lineas del archivo
+ */
+int escribirFuente(Contexto* ctx, FILE *fptr) {
+	FILE* fuente = abrirFuente(ctx);
+	int lineas = 0, nueva = 1, c;
+
+	fprintf(fptr,"static const char* const _wwe_fuente[] = {\"\"");
+	while(fuente && (c = fgetc(fuente)) != EOF) {
+		if(nueva) {
+			fprintf(fptr,",\n\"");
+			lineas++;
+			nueva = 0;
+		}
+		if(c == '\n') {
+			fprintf(fptr,"\"");
+			nueva = 1;
+		} else if(c == '"' || c == '\\')
+			fprintf(fptr,"\\%c",c);
+		else if(c == '\t')
+			fprintf(fptr,"    ");
+		else if(c != '\r')
+			fputc(c,fptr);
+	}
+	if(!nueva)
+		fprintf(fptr,"\"");
+	fprintf(fptr,"};\n\n");
+
+	if(fuente)
+		fclose(fuente);
+	return lineas;
+}
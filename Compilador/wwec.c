@@ -0,0 +1,185 @@
+/**
+ * @file wwec.c
+ * @brief Implementación de la libreria wwec.
+ *
+ * Cada funcion trabaja sobre el contexto que recibe. El texto del programa se
+ * lee con un archivo en memoria y el codigo C se escribe a otro, asi el lexico
+ * y el traductor son los mismos que usa el programa wwe.
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "wwec.h"
+#include "Contexto.h"
+
+/**
+ * @brief Crear contexto
+ * @ingroup funciones_wwec
+ *
+ * @return wwec_contexto* Contexto nuevo con las opciones por defecto
+ */
+wwec_contexto* wwec_crear(void)
+{
+    Opciones opciones = OPCIONES_DEFECTO;
+    Contexto* ctx = (Contexto*)malloc(sizeof(Contexto));
+    inicializarContexto(ctx,"programa.wwe",NULL,&opciones);
+    ctx->guardarMensajes = 1;
+    return ctx;
+}
+
+/**
+ * @brief Destruir contexto
+ * @ingroup funciones_wwec
+ *
+ * @param ctx Contexto a destruir, con todo lo que se creo al compilar
+ */
+void wwec_destruir(wwec_contexto* ctx)
+{
+    if(!ctx)
+        return;
+    liberarContexto(ctx);
+    free(ctx);
+}
+
+/**
+ * @brief Poner opcion
+ * @ingroup funciones_wwec
+ *
+ * Los cambios se usan a partir de la siguiente compilacion. El numero de hilos
+ * y el reporte de tiempos no se pueden cambiar porque no se usan en la libreria.
+ *
+ * @param ctx Contexto
+ * @param opcion Opcion a cambiar
+ * @param valor Nuevo valor, un wwec_numero para WWEC_NUMERO y un booleano para las demas
+ *
+ * @return int Si la opcion y el valor son validos
+ */
+int wwec_poner_opcion(wwec_contexto* ctx, wwec_opcion opcion, int valor)
+{
+    switch(opcion)
+    {
+        case WWEC_NUMERO:
+            if(valor == WWEC_FLOAT)
+                ctx->opciones.numero = NUM_FLOAT;
+            else if(valor == WWEC_DOUBLE)
+                ctx->opciones.numero = NUM_DOUBLE;
+            else if(valor == WWEC_INT64)
+                ctx->opciones.numero = NUM_INT64;
+            else
+                return 0;
+            return 1;
+        case WWEC_CHECKED:
+            ctx->opciones.checked = valor != 0;
+            return 1;
+        case WWEC_ORDENAMIENTOS:
+            ctx->opciones.ordenamientos = valor != 0;
+            return 1;
+        case WWEC_PARALELO:
+            ctx->opciones.paralelo = valor != 0;
+            return 1;
+        case WWEC_PERFIL:
+            ctx->opciones.perfil = valor != 0;
+            return 1;
+        case WWEC_DEPURACION:
+            ctx->opciones.depuracion = valor != 0;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Compilar
+ * @ingroup funciones_wwec
+ *
+ * Hace el lexico, el parser, los enunciados y el optimizador sobre el texto.
+ * Borra lo que quedo de la compilacion anterior del mismo contexto. El nombre
+ * y el texto no se copian, deben seguir validos mientras se usa el resultado.
+ *
+ * @param ctx Contexto
+ * @param nombre Nombre del programa para las directivas #line y --profile
+ * @param fuente Texto del programa, no necesita terminar en '\0'
+ * @param tam Tamaño del texto
+ *
+ * @return int Si el programa esta correcto
+ */
+int wwec_compilar(wwec_contexto* ctx, const char* nombre, const char* fuente, size_t tam)
+{
+    Opciones opciones = ctx->opciones;
+    liberarContexto(ctx);
+    inicializarContexto(ctx,(char*)nombre,NULL,&opciones);
+    ctx->guardarMensajes = 1;
+    ctx->fuente = fuente;
+    ctx->tamFuente = tam;
+
+    return construirPrograma(ctx);
+}
+
+/**
+ * @brief Programa
+ * @ingroup funciones_wwec
+ *
+ * @param ctx Contexto
+ *
+ * @return wwec_enunciados* Lista de enunciados ya optimizada, NULL si la ultima compilacion fallo
+ */
+wwec_enunciados* wwec_programa(wwec_contexto* ctx)
+{
+    return ctx->programa;
+}
+
+/**
+ * @brief Codigo C
+ * @ingroup funciones_wwec
+ *
+ * Traduce el programa a C la primera vez que se pide, las siguientes regresa el
+ * mismo texto. Para compilarlo se necesitan Listas.h y Listas.c.
+ *
+ * @param ctx Contexto
+ * @param tam Donde se guarda el tamaño del codigo, puede ser NULL
+ *
+ * @return const char* Codigo C terminado en '\0', es del contexto. NULL si no hay programa
+ */
+const char* wwec_codigo(wwec_contexto* ctx, size_t* tam)
+{
+    if(!ctx->programa)
+        return NULL;
+
+    if(!ctx->codigo)
+    {
+        FILE* fptr = open_memstream(&ctx->codigo,&ctx->tamCodigo);
+        if(!fptr)
+            return NULL;
+        iniciarFase(&ctx->medicion);
+        traductor(ctx,fptr);
+        terminarFase(&ctx->medicion,FASE_TRADUCCION);
+    }
+
+    if(tam)
+        *tam = ctx->tamCodigo;
+    return ctx->codigo;
+}
+
+/**
+ * @brief Error
+ * @ingroup funciones_wwec
+ *
+ * La libreria no escribe nada en la salida del programa que la usa, los mensajes
+ * que el compilador escribiria se guardan en el contexto.
+ *
+ * @param ctx Contexto
+ * @param linea Donde se guarda la linea del error del parser, 0 si no hubo, puede ser NULL
+ * @param columna Donde se guarda la columna del error del parser, puede ser NULL
+ *
+ * @return const char* Mensajes de error de la ultima compilacion, uno por linea, es del contexto. NULL si no hubo error
+ */
+const char* wwec_error(wwec_contexto* ctx, int* linea, int* columna)
+{
+    if(linea)
+        *linea = ctx->lineaError;
+    if(columna)
+        *columna = ctx->columnaError;
+    return ctx->mensajes;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file wwec.h
+ * @brief Libreria wwec para usar el compilador desde otro programa.
+ *
+ * Este archivo contiene las funciones para compilar un programa WWE que ya
+ * esta en memoria, sin leer ni escribir archivos y sin crear procesos. Cada
+ * contexto tiene todo el estado de su compilacion, asi que se puede usar
+ * muchas veces seguidas y varios contextos pueden usarse en hilos distintos.
+ * Solo declara nombres que empiezan con wwec_ o WWEC_, las estructuras del
+ * compilador se manejan como tipos opacos.
+ *
+ * Uso:
+ * @code
+ * wwec_contexto* ctx = wwec_crear();
+ * wwec_poner_opcion(ctx,WWEC_CHECKED,1);
+ * if(wwec_compilar(ctx,"prueba.wwe",fuente,strlen(fuente)))
+ *     puts(wwec_codigo(ctx,NULL));
+ * else
+ *     fputs(wwec_error(ctx,NULL,NULL),stderr);
+ * wwec_destruir(ctx);
+ * @endcode
+ *
+ * @author Alexander Arellano Odabachea
+ */
+
+#pragma once
+#include <stddef.h>
+
+/**
+ * @brief Marca las funciones que exporta libwwec.so, lo demas se compila con -fvisibility=hidden
+ */
+#define WWEC_API __attribute__((visibility("default")))
+
+/**
+ * @brief Contexto de la libreria, es el mismo contexto que usa el compilador
+ */
+typedef struct Contexto wwec_contexto;
+
+/**
+ * @brief Lista de enunciados ya optimizada, es el mismo programa que usa el compilador
+ */
+typedef struct Programa wwec_enunciados;
+
+/**
+ * @brief Opciones de compilacion que se pueden cambiar con wwec_poner_opcion
+ */
+typedef enum {
+    WWEC_NUMERO, /**< Tipo de numero como --numeric, su valor es un wwec_numero */
+    WWEC_CHECKED, /**< Booleano para revisar los indices de las listas como --checked */
+    WWEC_ORDENAMIENTOS, /**< Booleano para cambiar los ordenamientos escritos a mano como --sort-idioms */
+    WWEC_PARALELO, /**< Booleano para hacer los ciclos independientes con varios hilos como --parallel */
+    WWEC_PERFIL, /**< Booleano para contar las veces y el tiempo de cada linea como --profile */
+    WWEC_DEPURACION /**< Booleano para escribir las directivas #line como -g */
+} wwec_opcion;
+
+/**
+ * @brief Valores de la opcion WWEC_NUMERO
+ */
+typedef enum {
+    WWEC_FLOAT, /**< Flotante de 32 bits */
+    WWEC_DOUBLE, /**< Flotante de 64 bits */
+    WWEC_INT64 /**< Entero de 64 bits */
+} wwec_numero;
+
+/**
+ * @defgroup funciones_wwec Funciones de la libreria wwec
+ * @{
+ */
+WWEC_API wwec_contexto* wwec_crear(void);
+WWEC_API void wwec_destruir(wwec_contexto* ctx);
+WWEC_API int wwec_poner_opcion(wwec_contexto* ctx, wwec_opcion opcion, int valor);
+WWEC_API int wwec_compilar(wwec_contexto* ctx, const char* nombre, const char* fuente, size_t tam);
+WWEC_API wwec_enunciados* wwec_programa(wwec_contexto* ctx);
+WWEC_API const char* wwec_codigo(wwec_contexto* ctx, size_t* tam);
+WWEC_API const char* wwec_error(wwec_contexto* ctx, int* linea, int* columna);
+/** @} */
@@ -1,39 +1,1234 @@
 #include "Listas.h"
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* Llave sin signo que se ordena igual que el numero, -0 y 0 tienen la misma llave */
+#if defined(WWE_INT64)
+typedef uint64_t Llave;
+
+static inline Llave llaveNumero(Numero num)
+{
+    return (uint64_t)num ^ 0x8000000000000000ULL;
+}
+#elif defined(WWE_DOUBLE)
+typedef uint64_t Llave;
+
+static inline Llave llaveNumero(Numero num)
+{
+    uint64_t bits;
+    if(num == 0)
+        num = 0;
+    memcpy(&bits,&num,sizeof(bits));
+    return (bits >> 63) ? ~bits : bits | 0x8000000000000000ULL;
+}
+#else
+typedef uint32_t Llave;
+
+static inline Llave llaveNumero(Numero num)
+{
+    uint32_t bits;
+    if(num == 0)
+        num = 0;
+    memcpy(&bits,&num,sizeof(bits));
+    return (bits >> 31) ? ~bits : bits | 0x80000000U;
+}
+#endif
+
+/* Abajo de este tamaño es mas rapido ordenar por insercion */
+#define MINIMO_RADIX 64
+
+/* Las operaciones de toda la lista usan SSE2 y AVX2 si el procesador lo tiene, si no se hacen elemento por elemento */
+#if defined(__SSE2__)
+#include <immintrin.h>
+#define WWE_SIMD
+#define AVX2 __attribute__((target("avx2")))
+#endif
+
+/* Las sumas de flotantes se acumulan en double */
+#if defined(WWE_INT64)
+typedef int64_t Acumulado;
+#else
+typedef double Acumulado;
+#endif
 
 void inicializarArray(Lista* lista)
 {
     lista->size = 10;
     lista->ultimo = 0;
-    lista->arr = (float*)calloc(lista->size,sizeof(float));
+    lista->mapeado = 0;
+    lista->arr = (Numero*)malloc(lista->size*sizeof(Numero));
+    if(!lista->arr)
+        errorMemoria(lista->size);
 }
 
-void pushLista(Lista* lista,float num)
+void reservarLista(Lista* lista,long total)
 {
-    lista->arr[lista->ultimo] = num;
-    lista->ultimo++;
+    if(total > lista->size)
+        crecerLista(lista,total);
+}
+
+void reservarAdicional(Lista* lista,long cantidad)
+{
+    if(cantidad > 0)
+        reservarLista(lista,lista->ultimo + cantidad);
+}
+
+void crecerLista(Lista* lista,long minimo)
+{
+    long nuevo = lista->size * 2;
+    if(nuevo < minimo)
+        nuevo = minimo;
 
-    if(lista->ultimo >= lista->size)
+    //Una lista cargada de un archivo se pasa a memoria propia la primera vez que crece
+    if(lista->mapeado)
     {
-        lista->size *= 2;
-        lista->arr = (float*)realloc(lista->arr,lista->size*sizeof(float));
-        for(int i = lista->ultimo; i < lista->size; i++)
+        Numero* arr = (Numero*)malloc(nuevo*sizeof(Numero));
+        if(!arr)
+            errorMemoria(nuevo);
+        memcpy(arr,lista->arr,lista->ultimo*sizeof(Numero));
+        munmap(lista->arr,lista->mapeado);
+        lista->mapeado = 0;
+        lista->arr = arr;
+        lista->size = nuevo;
+        return;
+    }
+
+    //Si realloc falla el arreglo viejo sigue siendo valido, por eso no se pisa
+    Numero* arr = (Numero*)realloc(lista->arr,nuevo*sizeof(Numero));
+    if(!arr)
+        errorMemoria(nuevo);
+
+    lista->arr = arr;
+    lista->size = nuevo;
+}
+
+void liberarLista(Lista* lista)
+{
+    if(lista->mapeado)
+        munmap(lista->arr,lista->mapeado);
+    else
+        free(lista->arr);
+    lista->arr = NULL;
+    lista->ultimo = 0;
+    lista->size = 0;
+    lista->mapeado = 0;
+}
+
+/* El archivo binario solo tiene los elementos seguidos, del mismo tipo que Numero.
+   Se escribe en un temporal de la misma carpeta y se renombra encima, asi una lista cargada
+   del mismo archivo sigue mapeada al contenido viejo y nunca queda un archivo a medias */
+void guardarLista(Lista* lista,const char* archivo)
+{
+    long largo = strlen(archivo) + 32;
+    char* temporal = (char*)malloc(largo);
+    if(!temporal)
+        errorMemoria(largo);
+    snprintf(temporal,largo,"%s.%ld.tmp",archivo,(long)getpid());
+
+    FILE* f = fopen(temporal,"wb");
+    if(!f)
+        errorArchivo(archivo);
+    int escrito = fwrite(lista->arr,sizeof(Numero),lista->ultimo,f) == (size_t)lista->ultimo;
+    if(fclose(f))
+        escrito = 0;
+    if(!escrito || rename(temporal,archivo))
+    {
+        int error = errno;
+        unlink(temporal);
+        errno = error;
+        errorArchivo(archivo);
+    }
+    free(temporal);
+}
+
+/* Lee hasta el final cuando el archivo no se puede mapear, por ejemplo una tuberia */
+static void leerArchivo(Lista* lista,int fd,const char* archivo)
+{
+    char* destino = (char*)lista->arr;
+    long bytes = 0;
+    for(;;)
+    {
+        if(bytes + (long)sizeof(Numero) > lista->size*(long)sizeof(Numero))
+        {
+            crecerLista(lista,lista->size + 1);
+            destino = (char*)lista->arr;
+        }
+        ssize_t leidos = read(fd,destino + bytes,lista->size*sizeof(Numero) - bytes);
+        if(leidos < 0 && errno == EINTR)
+            continue;
+        if(leidos < 0)
+            errorArchivo(archivo);
+        if(leidos == 0)
+            break;
+        bytes += leidos;
+        lista->ultimo = bytes / sizeof(Numero);
+    }
+    if(bytes % sizeof(Numero))
+        errorFormato(archivo);
+}
+
+void cargarLista(Lista* lista,const char* archivo)
+{
+    int fd = open(archivo,O_RDONLY);
+    if(fd < 0)
+        errorArchivo(archivo);
+
+    struct stat info;
+    if(fstat(fd,&info) < 0)
+        errorArchivo(archivo);
+
+    liberarLista(lista);
+
+    if(S_ISREG(info.st_mode) && info.st_size > 0)
+    {
+        if(info.st_size % sizeof(Numero))
+            errorFormato(archivo);
+
+        //Privado: escribir un elemento copia solo esa pagina y el archivo no cambia
+        void* mapa = mmap(NULL,info.st_size,PROT_READ | PROT_WRITE,MAP_PRIVATE,fd,0);
+        if(mapa != MAP_FAILED)
         {
-            lista->arr[i] = 0;
+            lista->arr = (Numero*)mapa;
+            lista->ultimo = info.st_size / sizeof(Numero);
+            lista->size = lista->ultimo;
+            lista->mapeado = info.st_size;
+            close(fd);
+            return;
         }
     }
+
+    inicializarArray(lista);
+    leerArchivo(lista,fd,archivo);
+    close(fd);
 }
 
-float getUltimo(Lista* lista)
+//El arreglo ya no empieza en ceros, en una lista vacia no hay nada que leer
+Numero getUltimo(Lista* lista)
 {
+    if(lista->ultimo == 0)
+        errorVacia();
     return lista->arr[lista->ultimo - 1];
 }
 
-float getPrimero(Lista* lista)
+Numero getPrimero(Lista* lista)
 {
+    if(lista->ultimo == 0)
+        errorVacia();
     return lista->arr[0];
 }
 
-float getSize(Lista* lista)
+long getSize(Lista* lista)
 {
     return lista->ultimo;
-}
\ No newline at end of file
+}
+
+static void ordenarInsercion(Numero* arr,long n)
+{
+    for(long i = 1; i < n; i++)
+    {
+        Numero actual = arr[i];
+        long j = i - 1;
+        while(j >= 0 && arr[j] > actual)
+        {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = actual;
+    }
+}
+
+/* Radix sort LSD de 8 bits, es estable y se salta las pasadas donde todos tienen el mismo digito */
+static void ordenarNumeros(Numero* arr,long n)
+{
+    if(n < MINIMO_RADIX)
+    {
+        ordenarInsercion(arr,n);
+        return;
+    }
+
+    Numero* aux = (Numero*)malloc(n*sizeof(Numero));
+    if(!aux)
+        errorMemoria(n);
+
+    Numero* origen = arr;
+    Numero* destino = aux;
+
+    for(unsigned desplazamiento = 0; desplazamiento < sizeof(Llave)*8; desplazamiento += 8)
+    {
+        long cuenta[257] = {0};
+        for(long i = 0; i < n; i++)
+            cuenta[((llaveNumero(origen[i]) >> desplazamiento) & 0xFF) + 1]++;
+
+        if(cuenta[((llaveNumero(origen[0]) >> desplazamiento) & 0xFF) + 1] == n)
+            continue;
+
+        for(int d = 0; d < 256; d++)
+            cuenta[d + 1] += cuenta[d];
+
+        for(long i = 0; i < n; i++)
+            destino[cuenta[(llaveNumero(origen[i]) >> desplazamiento) & 0xFF]++] = origen[i];
+
+        Numero* temp = origen;
+        origen = destino;
+        destino = temp;
+    }
+
+    if(origen != arr)
+        memcpy(arr,origen,n*sizeof(Numero));
+    free(aux);
+}
+
+void ordenarLista(Lista* lista)
+{
+    ordenarNumeros(lista->arr,lista->ultimo);
+}
+
+void ordenarListaHasta(Lista* lista,double limite)
+{
+    long n = (long)limite;
+    if(n < limite)
+        n++;
+    if(n > lista->ultimo)
+        n = lista->ultimo;
+    if(n > 0)
+        ordenarNumeros(lista->arr,n);
+}
+
+/* Los limites de los ciclos paralelos se saturan para que restar dos de ellos no se desborde */
+#define LIMITE_CICLO (1L << 62)
+
+static long pisoLimite(double limite)
+{
+    if(limite != limite || limite <= -(double)LIMITE_CICLO)
+        return -LIMITE_CICLO;
+    if(limite >= (double)LIMITE_CICLO)
+        return LIMITE_CICLO;
+
+    long n = (long)limite;
+    return n > limite ? n - 1 : n;
+}
+
+/* Primer contador que ya no cumple contador < limite (o <= si incluye), NaN no da vueltas */
+long limiteArriba(double limite,int incluye)
+{
+    if(limite != limite)
+        return -LIMITE_CICLO;
+
+    long piso = pisoLimite(limite);
+    return incluye || piso < limite ? piso + 1 : piso;
+}
+
+/* Primer contador que ya no cumple contador > limite (o >= si incluye), NaN no da vueltas */
+long limiteAbajo(double limite,int incluye)
+{
+    if(limite != limite)
+        return LIMITE_CICLO;
+
+    long piso = pisoLimite(limite);
+    if(incluye)
+        return piso < limite ? piso : piso - 1;
+    return piso;
+}
+
+static Acumulado sumaEscalar(const Numero* arr,long desde,long n)
+{
+    Acumulado suma = 0;
+    for(long i = desde; i < n; i++)
+        suma += arr[i];
+    return suma;
+}
+
+static Acumulado puntoEscalar(const Numero* a,const Numero* b,long desde,long n)
+{
+    Acumulado suma = 0;
+    for(long i = desde; i < n; i++)
+        suma += (Acumulado)a[i] * b[i];
+    return suma;
+}
+
+static Numero extremoEscalar(const Numero* arr,long desde,long n,Numero actual,int maximo)
+{
+    for(long i = desde; i < n; i++)
+        if(maximo ? arr[i] > actual : arr[i] < actual)
+            actual = arr[i];
+    return actual;
+}
+
+static void operarEscalar(Numero* arr,long desde,long n,char op,Numero valor)
+{
+    for(long i = desde; i < n; i++)
+    {
+        if(op == '+')
+            arr[i] += valor;
+        else if(op == '*')
+            arr[i] *= valor;
+        else
+            arr[i] /= valor;
+    }
+}
+
+#if defined(WWE_SIMD) && defined(WWE_INT64)
+/* SSE2 y AVX2 no tienen multiplicacion de 64 bits, el producto punto, *= y /= se quedan escalares */
+static Acumulado sumaSSE2(const Numero* arr,long n)
+{
+    __m128i suma = _mm_setzero_si128();
+    long i = 0;
+    for(; i + 2 <= n; i += 2)
+        suma = _mm_add_epi64(suma,_mm_loadu_si128((const __m128i*)(arr + i)));
+
+    int64_t partes[2];
+    _mm_storeu_si128((__m128i*)partes,suma);
+    return partes[0] + partes[1] + sumaEscalar(arr,i,n);
+}
+
+static AVX2 Acumulado sumaAVX2(const Numero* arr,long n)
+{
+    __m256i suma = _mm256_setzero_si256();
+    long i = 0;
+    for(; i + 4 <= n; i += 4)
+        suma = _mm256_add_epi64(suma,_mm256_loadu_si256((const __m256i*)(arr + i)));
+
+    int64_t partes[4];
+    _mm256_storeu_si256((__m256i*)partes,suma);
+    return partes[0] + partes[1] + partes[2] + partes[3] + sumaEscalar(arr,i,n);
+}
+
+static Acumulado puntoSSE2(const Numero* a,const Numero* b,long n)
+{
+    return puntoEscalar(a,b,0,n);
+}
+
+static Acumulado puntoAVX2(const Numero* a,const Numero* b,long n)
+{
+    return puntoEscalar(a,b,0,n);
+}
+
+/* SSE2 no puede comparar enteros de 64 bits */
+static Numero extremoSSE2(const Numero* arr,long n,int maximo)
+{
+    return extremoEscalar(arr,1,n,arr[0],maximo);
+}
+
+static AVX2 Numero extremoAVX2(const Numero* arr,long n,int maximo)
+{
+    long i = 0;
+    Numero actual = arr[0];
+    if(n >= 4)
+    {
+        __m256i extremo = _mm256_loadu_si256((const __m256i*)arr);
+        for(i = 4; i + 4 <= n; i += 4)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(arr + i));
+            __m256i cambiar = maximo ? _mm256_cmpgt_epi64(v,extremo) : _mm256_cmpgt_epi64(extremo,v);
+            extremo = _mm256_blendv_epi8(extremo,v,cambiar);
+        }
+
+        int64_t partes[4];
+        _mm256_storeu_si256((__m256i*)partes,extremo);
+        actual = extremoEscalar(partes,1,4,partes[0],maximo);
+    }
+    return extremoEscalar(arr,i,n,actual,maximo);
+}
+
+static void operarSSE2(Numero* arr,long n,char op,Numero valor)
+{
+    long i = 0;
+    if(op == '+')
+    {
+        __m128i k = _mm_set1_epi64x(valor);
+        for(; i + 2 <= n; i += 2)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(arr + i));
+            _mm_storeu_si128((__m128i*)(arr + i),_mm_add_epi64(v,k));
+        }
+    }
+    operarEscalar(arr,i,n,op,valor);
+}
+
+static AVX2 void operarAVX2(Numero* arr,long n,char op,Numero valor)
+{
+    long i = 0;
+    if(op == '+')
+    {
+        __m256i k = _mm256_set1_epi64x(valor);
+        for(; i + 4 <= n; i += 4)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(arr + i));
+            _mm256_storeu_si256((__m256i*)(arr + i),_mm256_add_epi64(v,k));
+        }
+    }
+    operarEscalar(arr,i,n,op,valor);
+}
+#elif defined(WWE_SIMD) && defined(WWE_DOUBLE)
+static Acumulado sumaSSE2(const Numero* arr,long n)
+{
+    __m128d suma = _mm_setzero_pd();
+    long i = 0;
+    for(; i + 2 <= n; i += 2)
+        suma = _mm_add_pd(suma,_mm_loadu_pd(arr + i));
+
+    double partes[2];
+    _mm_storeu_pd(partes,suma);
+    return partes[0] + partes[1] + sumaEscalar(arr,i,n);
+}
+
+static AVX2 Acumulado sumaAVX2(const Numero* arr,long n)
+{
+    __m256d suma = _mm256_setzero_pd();
+    long i = 0;
+    for(; i + 4 <= n; i += 4)
+        suma = _mm256_add_pd(suma,_mm256_loadu_pd(arr + i));
+
+    double partes[4];
+    _mm256_storeu_pd(partes,suma);
+    return partes[0] + partes[1] + partes[2] + partes[3] + sumaEscalar(arr,i,n);
+}
+
+static Acumulado puntoSSE2(const Numero* a,const Numero* b,long n)
+{
+    __m128d suma = _mm_setzero_pd();
+    long i = 0;
+    for(; i + 2 <= n; i += 2)
+        suma = _mm_add_pd(suma,_mm_mul_pd(_mm_loadu_pd(a + i),_mm_loadu_pd(b + i)));
+
+    double partes[2];
+    _mm_storeu_pd(partes,suma);
+    return partes[0] + partes[1] + puntoEscalar(a,b,i,n);
+}
+
+static AVX2 Acumulado puntoAVX2(const Numero* a,const Numero* b,long n)
+{
+    __m256d suma = _mm256_setzero_pd();
+    long i = 0;
+    for(; i + 4 <= n; i += 4)
+        suma = _mm256_add_pd(suma,_mm256_mul_pd(_mm256_loadu_pd(a + i),_mm256_loadu_pd(b + i)));
+
+    double partes[4];
+    _mm256_storeu_pd(partes,suma);
+    return partes[0] + partes[1] + partes[2] + partes[3] + puntoEscalar(a,b,i,n);
+}
+
+static Numero extremoSSE2(const Numero* arr,long n,int maximo)
+{
+    long i = 0;
+    Numero actual = arr[0];
+    if(n >= 2)
+    {
+        __m128d extremo = _mm_loadu_pd(arr);
+        for(i = 2; i + 2 <= n; i += 2)
+        {
+            __m128d v = _mm_loadu_pd(arr + i);
+            extremo = maximo ? _mm_max_pd(extremo,v) : _mm_min_pd(extremo,v);
+        }
+
+        double partes[2];
+        _mm_storeu_pd(partes,extremo);
+        actual = extremoEscalar(partes,1,2,partes[0],maximo);
+    }
+    return extremoEscalar(arr,i,n,actual,maximo);
+}
+
+static AVX2 Numero extremoAVX2(const Numero* arr,long n,int maximo)
+{
+    long i = 0;
+    Numero actual = arr[0];
+    if(n >= 4)
+    {
+        __m256d extremo = _mm256_loadu_pd(arr);
+        for(i = 4; i + 4 <= n; i += 4)
+        {
+            __m256d v = _mm256_loadu_pd(arr + i);
+            extremo = maximo ? _mm256_max_pd(extremo,v) : _mm256_min_pd(extremo,v);
+        }
+
+        double partes[4];
+        _mm256_storeu_pd(partes,extremo);
+        actual = extremoEscalar(partes,1,4,partes[0],maximo);
+    }
+    return extremoEscalar(arr,i,n,actual,maximo);
+}
+
+static void operarSSE2(Numero* arr,long n,char op,Numero valor)
+{
+    __m128d k = _mm_set1_pd(valor);
+    long i = 0;
+    for(; i + 2 <= n; i += 2)
+    {
+        __m128d v = _mm_loadu_pd(arr + i);
+        v = op == '+' ? _mm_add_pd(v,k) : op == '*' ? _mm_mul_pd(v,k) : _mm_div_pd(v,k);
+        _mm_storeu_pd(arr + i,v);
+    }
+    operarEscalar(arr,i,n,op,valor);
+}
+
+static AVX2 void operarAVX2(Numero* arr,long n,char op,Numero valor)
+{
+    __m256d k = _mm256_set1_pd(valor);
+    long i = 0;
+    for(; i + 4 <= n; i += 4)
+    {
+        __m256d v = _mm256_loadu_pd(arr + i);
+        v = op == '+' ? _mm256_add_pd(v,k) : op == '*' ? _mm256_mul_pd(v,k) : _mm256_div_pd(v,k);
+        _mm256_storeu_pd(arr + i,v);
+    }
+    operarEscalar(arr,i,n,op,valor);
+}
+#elif defined(WWE_SIMD)
+/* Cada flotante se convierte a double antes de sumar o multiplicar */
+static Acumulado sumaSSE2(const Numero* arr,long n)
+{
+    __m128d suma0 = _mm_setzero_pd(), suma1 = _mm_setzero_pd();
+    long i = 0;
+    for(; i + 4 <= n; i += 4)
+    {
+        __m128 v = _mm_loadu_ps(arr + i);
+        suma0 = _mm_add_pd(suma0,_mm_cvtps_pd(v));
+        suma1 = _mm_add_pd(suma1,_mm_cvtps_pd(_mm_movehl_ps(v,v)));
+    }
+
+    double partes[2];
+    _mm_storeu_pd(partes,_mm_add_pd(suma0,suma1));
+    return partes[0] + partes[1] + sumaEscalar(arr,i,n);
+}
+
+static AVX2 Acumulado sumaAVX2(const Numero* arr,long n)
+{
+    __m256d suma0 = _mm256_setzero_pd(), suma1 = _mm256_setzero_pd();
+    long i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        __m256 v = _mm256_loadu_ps(arr + i);
+        suma0 = _mm256_add_pd(suma0,_mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        suma1 = _mm256_add_pd(suma1,_mm256_cvtps_pd(_mm256_extractf128_ps(v,1)));
+    }
+
+    double partes[4];
+    _mm256_storeu_pd(partes,_mm256_add_pd(suma0,suma1));
+    return partes[0] + partes[1] + partes[2] + partes[3] + sumaEscalar(arr,i,n);
+}
+
+static Acumulado puntoSSE2(const Numero* a,const Numero* b,long n)
+{
+    __m128d suma0 = _mm_setzero_pd(), suma1 = _mm_setzero_pd();
+    long i = 0;
+    for(; i + 4 <= n; i += 4)
+    {
+        __m128 va = _mm_loadu_ps(a + i);
+        __m128 vb = _mm_loadu_ps(b + i);
+        suma0 = _mm_add_pd(suma0,_mm_mul_pd(_mm_cvtps_pd(va),_mm_cvtps_pd(vb)));
+        suma1 = _mm_add_pd(suma1,_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(va,va)),_mm_cvtps_pd(_mm_movehl_ps(vb,vb))));
+    }
+
+    double partes[2];
+    _mm_storeu_pd(partes,_mm_add_pd(suma0,suma1));
+    return partes[0] + partes[1] + puntoEscalar(a,b,i,n);
+}
+
+static AVX2 Acumulado puntoAVX2(const Numero* a,const Numero* b,long n)
+{
+    __m256d suma0 = _mm256_setzero_pd(), suma1 = _mm256_setzero_pd();
+    long i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        __m256 va = _mm256_loadu_ps(a + i);
+        __m256 vb = _mm256_loadu_ps(b + i);
+        suma0 = _mm256_add_pd(suma0,_mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(va)),_mm256_cvtps_pd(_mm256_castps256_ps128(vb))));
+        suma1 = _mm256_add_pd(suma1,_mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(va,1)),_mm256_cvtps_pd(_mm256_extractf128_ps(vb,1))));
+    }
+
+    double partes[4];
+    _mm256_storeu_pd(partes,_mm256_add_pd(suma0,suma1));
+    return partes[0] + partes[1] + partes[2] + partes[3] + puntoEscalar(a,b,i,n);
+}
+
+static Numero extremoSSE2(const Numero* arr,long n,int maximo)
+{
+    long i = 0;
+    Numero actual = arr[0];
+    if(n >= 4)
+    {
+        __m128 extremo = _mm_loadu_ps(arr);
+        for(i = 4; i + 4 <= n; i += 4)
+        {
+            __m128 v = _mm_loadu_ps(arr + i);
+            extremo = maximo ? _mm_max_ps(extremo,v) : _mm_min_ps(extremo,v);
+        }
+
+        float partes[4];
+        _mm_storeu_ps(partes,extremo);
+        actual = extremoEscalar(partes,1,4,partes[0],maximo);
+    }
+    return extremoEscalar(arr,i,n,actual,maximo);
+}
+
+static AVX2 Numero extremoAVX2(const Numero* arr,long n,int maximo)
+{
+    long i = 0;
+    Numero actual = arr[0];
+    if(n >= 8)
+    {
+        __m256 extremo = _mm256_loadu_ps(arr);
+        for(i = 8; i + 8 <= n; i += 8)
+        {
+            __m256 v = _mm256_loadu_ps(arr + i);
+            extremo = maximo ? _mm256_max_ps(extremo,v) : _mm256_min_ps(extremo,v);
+        }
+
+        float partes[8];
+        _mm256_storeu_ps(partes,extremo);
+        actual = extremoEscalar(partes,1,8,partes[0],maximo);
+    }
+    return extremoEscalar(arr,i,n,actual,maximo);
+}
+
+static void operarSSE2(Numero* arr,long n,char op,Numero valor)
+{
+    __m128 k = _mm_set1_ps(valor);
+    long i = 0;
+    for(; i + 4 <= n; i += 4)
+    {
+        __m128 v = _mm_loadu_ps(arr + i);
+        v = op == '+' ? _mm_add_ps(v,k) : op == '*' ? _mm_mul_ps(v,k) : _mm_div_ps(v,k);
+        _mm_storeu_ps(arr + i,v);
+    }
+    operarEscalar(arr,i,n,op,valor);
+}
+
+static AVX2 void operarAVX2(Numero* arr,long n,char op,Numero valor)
+{
+    __m256 k = _mm256_set1_ps(valor);
+    long i = 0;
+    for(; i + 8 <= n; i += 8)
+    {
+        __m256 v = _mm256_loadu_ps(arr + i);
+        v = op == '+' ? _mm256_add_ps(v,k) : op == '*' ? _mm256_mul_ps(v,k) : _mm256_div_ps(v,k);
+        _mm256_storeu_ps(arr + i,v);
+    }
+    operarEscalar(arr,i,n,op,valor);
+}
+#endif
+
+#ifdef WWE_SIMD
+static int hayAVX2(void)
+{
+    static int avx2 = -1;
+    if(avx2 < 0)
+        avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+    return avx2;
+}
+#endif
+
+Numero sumaLista(Lista* lista)
+{
+#ifdef WWE_SIMD
+    if(hayAVX2())
+        return (Numero)sumaAVX2(lista->arr,lista->ultimo);
+    return (Numero)sumaSSE2(lista->arr,lista->ultimo);
+#else
+    return (Numero)sumaEscalar(lista->arr,0,lista->ultimo);
+#endif
+}
+
+Numero productoPunto(Lista* a,Lista* b)
+{
+    if(a->ultimo != b->ultimo)
+        errorTamanos(a->ultimo,b->ultimo);
+#ifdef WWE_SIMD
+    if(hayAVX2())
+        return (Numero)puntoAVX2(a->arr,b->arr,a->ultimo);
+    return (Numero)puntoSSE2(a->arr,b->arr,a->ultimo);
+#else
+    return (Numero)puntoEscalar(a->arr,b->arr,0,a->ultimo);
+#endif
+}
+
+static Numero extremoLista(Lista* lista,int maximo)
+{
+    if(lista->ultimo == 0)
+        errorVacia();
+#ifdef WWE_SIMD
+    if(hayAVX2())
+        return extremoAVX2(lista->arr,lista->ultimo,maximo);
+    return extremoSSE2(lista->arr,lista->ultimo,maximo);
+#else
+    return extremoEscalar(lista->arr,1,lista->ultimo,lista->arr[0],maximo);
+#endif
+}
+
+Numero minimoLista(Lista* lista)
+{
+    return extremoLista(lista,0);
+}
+
+Numero maximoLista(Lista* lista)
+{
+    return extremoLista(lista,1);
+}
+
+static void operarLista(Lista* lista,char op,Numero valor)
+{
+#ifdef WWE_SIMD
+    if(hayAVX2())
+        operarAVX2(lista->arr,lista->ultimo,op,valor);
+    else
+        operarSSE2(lista->arr,lista->ultimo,op,valor);
+#else
+    operarEscalar(lista->arr,0,lista->ultimo,op,valor);
+#endif
+}
+
+void sumarEscalar(Lista* lista,Numero valor)
+{
+    operarLista(lista,'+',valor);
+}
+
+void multiplicarEscalar(Lista* lista,Numero valor)
+{
+    operarLista(lista,'*',valor);
+}
+
+void dividirEscalar(Lista* lista,Numero valor)
+{
+    operarLista(lista,'/',valor);
+}
+
+/* La entrada se lee por bloques grandes con read en lugar de scanf */
+#define TAM_ENTRADA 65536
+#define TAM_PALABRA 128
+
+static char entrada[TAM_ENTRADA];
+static long posEntrada = 0;
+static long finEntrada = 0;
+
+/* Regresa el siguiente caracter de la entrada o -1 al terminar */
+static inline int siguienteCaracter(void)
+{
+    if(posEntrada == finEntrada)
+    {
+        ssize_t leidos;
+        /* Lo que se anuncio antes de pedir datos se debe ver en la consola */
+        vaciarSalida();
+        do
+            leidos = read(0,entrada,TAM_ENTRADA);
+        while(leidos < 0 && errno == EINTR);
+        if(leidos <= 0)
+            return -1;
+        posEntrada = 0;
+        finEntrada = leidos;
+    }
+    return (unsigned char)entrada[posEntrada++];
+}
+
+static inline int esEspacio(int c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/* Copia la siguiente palabra de la entrada, si es mas larga se descarta el resto. Regresa 0 al terminar la entrada */
+static int siguientePalabra(char* palabra)
+{
+    int c = siguienteCaracter();
+    while(esEspacio(c))
+        c = siguienteCaracter();
+    if(c < 0)
+        return 0;
+
+    int n = 0;
+    while(c >= 0 && !esEspacio(c))
+    {
+        if(n < TAM_PALABRA - 1)
+            palabra[n++] = (char)c;
+        c = siguienteCaracter();
+    }
+    palabra[n] = '\0';
+    return 1;
+}
+
+#if defined(WWE_INT64)
+/* Como scanf se toma el entero del inicio de la palabra y se ignora lo demas */
+static int convertirPalabra(const char* palabra,Numero* num)
+{
+    const char* c = palabra;
+    int negativo = *c == '-';
+    if(*c == '-' || *c == '+')
+        c++;
+    if(*c < '0' || *c > '9')
+        return 0;
+
+    uint64_t valor = 0;
+    int digitos = 0;
+    for(; *c >= '0' && *c <= '9'; c++, digitos++)
+        valor = valor*10 + (uint64_t)(*c - '0');
+
+    /* Con mas de 18 digitos puede desbordar, strtoll lo satura igual que scanf */
+    if(digitos > 18)
+        *num = (Numero)strtoll(palabra,NULL,10);
+    else
+        *num = negativo ? -(Numero)valor : (Numero)valor;
+    return 1;
+}
+#else
+#if defined(WWE_DOUBLE)
+/* Con mantisa menor a 2^53 y potencia hasta 10^22 una sola operacion redondea igual que strtod */
+#define MANTISA_EXACTA (1ULL << 53)
+#define POTENCIA_EXACTA 22
+#define convertirLento(palabra,fin) strtod(palabra,fin)
+#else
+#define MANTISA_EXACTA (1ULL << 24)
+#define POTENCIA_EXACTA 10
+#define convertirLento(palabra,fin) strtof(palabra,fin)
+#endif
+
+static const Numero potencias[] = {1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,1e8,1e9,1e10,
+    1e11,1e12,1e13,1e14,1e15,1e16,1e17,1e18,1e19,1e20,1e21,1e22};
+
+static int convertirPalabra(const char* palabra,Numero* num)
+{
+    const char* c = palabra;
+    int negativo = *c == '-';
+    if(*c == '-' || *c == '+')
+        c++;
+
+    uint64_t mantisa = 0;
+    int digitos = 0, exponente = 0, hayDigitos = 0;
+    for(; *c >= '0' && *c <= '9'; c++, hayDigitos = 1)
+        if(digitos < 19)
+        {
+            mantisa = mantisa*10 + (uint64_t)(*c - '0');
+            digitos += mantisa != 0;
+        }
+        else
+            exponente++;
+    if(*c == '.')
+        for(c++; *c >= '0' && *c <= '9'; c++, hayDigitos = 1)
+            if(digitos < 19)
+            {
+                mantisa = mantisa*10 + (uint64_t)(*c - '0');
+                digitos += mantisa != 0;
+                exponente--;
+            }
+    if(hayDigitos && (*c == 'e' || *c == 'E'))
+    {
+        const char* e = c + 1;
+        int negativoExp = *e == '-';
+        if(*e == '-' || *e == '+')
+            e++;
+        if(*e >= '0' && *e <= '9')
+        {
+            int valor = 0;
+            for(; *e >= '0' && *e <= '9'; e++)
+                if(valor < 100000)
+                    valor = valor*10 + (*e - '0');
+            exponente += negativoExp ? -valor : valor;
+            c = e;
+        }
+    }
+
+    /* inf, nan, hexadecimales, basura al final o numeros que no se pueden redondear en una operacion */
+    if(!hayDigitos || *c != '\0' || mantisa > MANTISA_EXACTA || exponente > POTENCIA_EXACTA || exponente < -POTENCIA_EXACTA)
+    {
+        char* fin;
+        Numero valor = convertirLento(palabra,&fin);
+        if(fin == palabra)
+            return 0;
+        *num = valor;
+        return 1;
+    }
+
+    Numero valor = (Numero)mantisa;
+    valor = exponente < 0 ? valor / potencias[-exponente] : valor * potencias[exponente];
+    *num = negativo ? -valor : valor;
+    return 1;
+}
+#endif
+
+int leerNumero(Numero* num)
+{
+    char palabra[TAM_PALABRA];
+    /* Las palabras que no son numeros se saltan para no atorar la entrada */
+    while(siguientePalabra(palabra))
+        if(convertirPalabra(palabra,num))
+            return 1;
+    return 0;
+}
+
+void leerEnLista(Lista* lista)
+{
+    /* Siempre se agrega un elemento, el optimizador cuenta con eso */
+    Numero num = 0;
+    leerNumero(&num);
+    pushLista(lista,num);
+}
+
+void leerTodo(Lista* lista)
+{
+    Numero num;
+    while(leerNumero(&num))
+        pushLista(lista,num);
+}
+
+/* La salida se junta en un buffer y se escribe con write cuando se llena, al pedir datos o al terminar */
+#define TAM_SALIDA 65536
+/* Lo mas largo que ocupa un numero menor a 2^63 con dos decimales */
+#define TAM_NUMERO 32
+
+static char salida[TAM_SALIDA];
+static long posSalida = 0;
+
+void vaciarSalida(void)
+{
+    long escritos = 0;
+    while(escritos < posSalida)
+    {
+        ssize_t n = write(1,salida + escritos,posSalida - escritos);
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+            break;
+        escritos += n;
+    }
+    posSalida = 0;
+}
+
+static inline void espacioSalida(long cantidad)
+{
+    if(posSalida + cantidad > TAM_SALIDA)
+        vaciarSalida();
+}
+
+void anunciarCadena(const char* cadena,long largo)
+{
+    if(largo > TAM_SALIDA)
+    {
+        vaciarSalida();
+        for(long escritos = 0; escritos < largo;)
+        {
+            ssize_t n = write(1,cadena + escritos,largo - escritos);
+            if(n < 0 && errno == EINTR)
+                continue;
+            if(n <= 0)
+                break;
+            escritos += n;
+        }
+        return;
+    }
+    espacioSalida(largo);
+    memcpy(salida + posSalida,cadena,largo);
+    posSalida += largo;
+}
+
+/* Escribe los digitos de valor y regresa cuantos caracteres ocupo */
+static inline int escribirDigitos(char* destino,uint64_t valor)
+{
+    char digitos[20];
+    int n = 0;
+    do
+    {
+        digitos[n++] = (char)('0' + valor % 10);
+        valor /= 10;
+    }while(valor);
+    for(int i = 0; i < n; i++)
+        destino[i] = digitos[n - 1 - i];
+    return n;
+}
+
+/* Igual que printf("%.2f") pero sin interpretar formato, regresa -1 si el numero se debe escribir con snprintf */
+static int formatearNumero(char* destino,double num)
+{
+    uint64_t bits;
+    memcpy(&bits,&num,sizeof(bits));
+    int exponente = (int)((bits >> 52) & 0x7ff);
+
+    /* inf y nan, y arriba de 2^63 ya no hay decimales pero los digitos no caben en un entero */
+    if(exponente == 0x7ff || exponente >= 1023 + 63)
+        return -1;
+
+    int n = 0;
+    if(bits >> 63)
+        destino[n++] = '-';
+
+    uint64_t entero = 0, centesimos = 0;
+    /* num = mantisa * 2^-corrimiento, los subnormales son menores a 2^-1022 y se escriben 0.00 */
+    uint64_t mantisa = (bits & ((1ULL << 52) - 1)) | (1ULL << 52);
+    int corrimiento = 1075 - exponente;
+
+    if(exponente == 0)
+        ;
+    else if(corrimiento <= 0)
+        entero = mantisa << -corrimiento;
+    else if(corrimiento < 64)
+    {
+        entero = mantisa >> corrimiento;
+        uint64_t resto = mantisa & ((1ULL << corrimiento) - 1);
+        /* Redondeo al par mas cercano sobre el valor exacto, como printf */
+        unsigned __int128 producto = (unsigned __int128)resto * 100;
+        centesimos = (uint64_t)(producto >> corrimiento);
+        unsigned __int128 sobra = producto - ((unsigned __int128)centesimos << corrimiento);
+        unsigned __int128 mitad = (unsigned __int128)1 << (corrimiento - 1);
+        if(sobra > mitad || (sobra == mitad && (centesimos & 1)))
+            centesimos++;
+        if(centesimos == 100)
+        {
+            entero++;
+            centesimos = 0;
+        }
+    }
+    /* Con corrimiento de 64 o mas el numero es menor a 2^-11 y se escribe 0.00 */
+
+    n += escribirDigitos(destino + n,entero);
+    destino[n++] = '.';
+    destino[n++] = (char)('0' + centesimos / 10);
+    destino[n++] = (char)('0' + centesimos % 10);
+    return n;
+}
+
+/* Igual que printf("%" PRId64 ".00") */
+static int formatearEntero(char* destino,int64_t num)
+{
+    int n = 0;
+    uint64_t valor = (uint64_t)num;
+    if(num < 0)
+    {
+        destino[n++] = '-';
+        valor = 0 - valor;
+    }
+    n += escribirDigitos(destino + n,valor);
+    destino[n++] = '.';
+    destino[n++] = '0';
+    destino[n++] = '0';
+    return n;
+}
+
+void anunciarNumero(double num)
+{
+    espacioSalida(TAM_NUMERO);
+    int n = formatearNumero(salida + posSalida,num);
+    if(n < 0)
+    {
+        /* El double mas grande ocupa 309 digitos antes del punto */
+        char grande[TAM_NUMERO + 320];
+        anunciarCadena(grande,snprintf(grande,sizeof(grande),"%.2f",num));
+        return;
+    }
+    posSalida += n;
+}
+
+void anunciarEntero(int64_t num)
+{
+    espacioSalida(TAM_NUMERO);
+    posSalida += formatearEntero(salida + posSalida,num);
+}
+
+void anunciarLista(Lista* lista,const char* separador,long largo)
+{
+    for(long i = 0; i < lista->ultimo; i++)
+    {
+        if(i > 0)
+            anunciarCadena(separador,largo);
+#if defined(WWE_INT64)
+        anunciarEntero(lista->arr[i]);
+#else
+        anunciarNumero(lista->arr[i]);
+#endif
+    }
+}
+
+void errorIndice(long indice, long tam)
+{
+    vaciarSalida();
+    fprintf(stderr,"\nIndice %ld fuera de la lista de tamaño %ld\n",indice,tam);
+    exit(1);
+}
+
+void errorMemoria(long tam)
+{
+    vaciarSalida();
+    fprintf(stderr,"\nNo hay memoria para una lista de %ld elementos\n",tam);
+    exit(1);
+}
+
+void errorVacia(void)
+{
+    vaciarSalida();
+    fprintf(stderr,"\nLa lista esta vacia\n");
+    exit(1);
+}
+
+void errorTamanos(long tam1, long tam2)
+{
+    vaciarSalida();
+    fprintf(stderr,"\nLas listas tienen tamaños distintos(%ld y %ld)\n",tam1,tam2);
+    exit(1);
+}
+
+void errorArchivo(const char* archivo)
+{
+    vaciarSalida();
+    fprintf(stderr,"\nNo se pudo usar el archivo %s: %s\n",archivo,strerror(errno));
+    exit(1);
+}
+
+void errorFormato(const char* archivo)
+{
+    vaciarSalida();
+    fprintf(stderr,"\nEl archivo %s no tiene una lista de este tipo de numero\n",archivo);
+    exit(1);
+}
+
+/* Perfil por linea con --profile, la linea 0 es lo que corre antes de la primera marca */
+LineaPerfil* perfilLineas = NULL;
+int perfilActual = 0;
+uint64_t perfilMarca = 0;
+
+static const char* perfilArchivo;
+static const char* const* perfilFuente;
+static int perfilTotal;
+static uint64_t perfilInicio;
+static struct timespec perfilReloj;
+
+void iniciarPerfil(const char* archivo,const char* const* fuente,int lineas)
+{
+    perfilLineas = (LineaPerfil*)calloc(lineas + 1,sizeof(LineaPerfil));
+    if(perfilLineas == NULL)
+        errorMemoria(lineas + 1);
+    perfilArchivo = archivo;
+    perfilFuente = fuente;
+    perfilTotal = lineas;
+    clock_gettime(CLOCK_MONOTONIC,&perfilReloj);
+    perfilInicio = perfilMarca = relojPerfil();
+    atexit(terminarPerfil);
+}
+
+void terminarPerfil(void)
+{
+    if(perfilLineas == NULL)
+        return;
+
+    uint64_t fin = relojPerfil();
+    struct timespec reloj;
+    clock_gettime(CLOCK_MONOTONIC,&reloj);
+    perfilLineas[perfilActual].ticks += fin - perfilMarca;
+
+    //Los ticks se pasan a milisegundos con lo que midio el reloj en todo el programa
+    double ms = (reloj.tv_sec - perfilReloj.tv_sec) * 1e3 + (reloj.tv_nsec - perfilReloj.tv_nsec) / 1e6;
+    double porTick = fin > perfilInicio ? ms / (double)(fin - perfilInicio) : 0;
+
+    vaciarSalida();
+    fprintf(stderr,"\nPerfil de %s (%.3f ms)\n",perfilArchivo,ms);
+    fprintf(stderr,"%6s %14s %12s %7s  %s\n","Linea","Veces","Tiempo ms","%","Codigo");
+    for(int i = 0; i <= perfilTotal; i++)
+    {
+        LineaPerfil* l = &perfilLineas[i];
+        if(!l->veces && (i > 0 || !l->ticks))
+            continue;
+        double tiempo = l->ticks * porTick;
+        fprintf(stderr,"%6d %14ld %12.3f %6.1f%%  %s\n",i,l->veces,tiempo,ms > 0 ? 100 * tiempo / ms : 0,i > 0 ? perfilFuente[i] : "(inicio)");
+    }
+
+    free(perfilLineas);
+    perfilLineas = NULL;
+}
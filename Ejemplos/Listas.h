@@ -1,15 +1,104 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <inttypes.h>
+#include <time.h>
+
+#if defined(WWE_INT64)
+typedef int64_t Numero;
+#elif defined(WWE_DOUBLE)
+typedef double Numero;
+#else
+typedef float Numero;
+#endif
+
+typedef struct LineaPerfil
+{
+    long veces;
+    uint64_t ticks;
+}LineaPerfil;
 
 typedef struct Lista
 {
-    float *arr;
-    int ultimo;
-    int size;
+    Numero *arr;
+    long ultimo;
+    long size;
+    long mapeado;
 }Lista;
 
 void inicializarArray(Lista* lista);
-void pushLista(Lista* lista,float num);
-float getUltimo(Lista* lista);
-float getPrimero(Lista* lista);
-float getSize(Lista* lista);
\ No newline at end of file
+void reservarLista(Lista* lista,long total);
+void reservarAdicional(Lista* lista,long cantidad);
+void crecerLista(Lista* lista,long minimo);
+void liberarLista(Lista* lista);
+void guardarLista(Lista* lista,const char* archivo);
+void cargarLista(Lista* lista,const char* archivo);
+Numero getUltimo(Lista* lista);
+Numero getPrimero(Lista* lista);
+long getSize(Lista* lista);
+void ordenarLista(Lista* lista);
+void ordenarListaHasta(Lista* lista,double limite);
+long limiteArriba(double limite,int incluye);
+long limiteAbajo(double limite,int incluye);
+Numero sumaLista(Lista* lista);
+Numero minimoLista(Lista* lista);
+Numero maximoLista(Lista* lista);
+Numero productoPunto(Lista* a,Lista* b);
+void sumarEscalar(Lista* lista,Numero valor);
+void multiplicarEscalar(Lista* lista,Numero valor);
+void dividirEscalar(Lista* lista,Numero valor);
+int leerNumero(Numero* num);
+void leerEnLista(Lista* lista);
+void leerTodo(Lista* lista);
+void anunciarCadena(const char* cadena,long largo);
+void anunciarNumero(double num);
+void anunciarEntero(int64_t num);
+void anunciarLista(Lista* lista,const char* separador,long largo);
+void vaciarSalida(void);
+void errorIndice(long indice, long tam);
+void errorMemoria(long tam);
+void errorVacia(void);
+void errorTamanos(long tam1, long tam2);
+void errorArchivo(const char* archivo);
+void errorFormato(const char* archivo);
+void iniciarPerfil(const char* archivo,const char* const* fuente,int lineas);
+void terminarPerfil(void);
+
+extern LineaPerfil* perfilLineas;
+extern int perfilActual;
+extern uint64_t perfilMarca;
+
+static inline void pushLista(Lista* lista,Numero num)
+{
+    if(lista->ultimo >= lista->size)
+        crecerLista(lista,lista->ultimo + 1);
+    lista->arr[lista->ultimo++] = num;
+}
+
+static inline long indiceChecado(Lista* lista, long indice)
+{
+    if(indice < 0 || indice >= lista->ultimo)
+        errorIndice(indice,lista->ultimo);
+    return indice;
+}
+
+/* Reloj del perfil, en x86 es el contador de ciclos y en otros procesadores nanosegundos */
+static inline uint64_t relojPerfil(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC,&t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + t.tv_nsec;
+#endif
+}
+
+/* Cuenta la linea y le da a la linea anterior el tiempo desde su marca */
+static inline void perfilLinea(int linea)
+{
+    uint64_t ahora = relojPerfil();
+    perfilLineas[perfilActual].ticks += ahora - perfilMarca;
+    perfilLineas[linea].veces++;
+    perfilActual = linea;
+    perfilMarca = ahora;
+}
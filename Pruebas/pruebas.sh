@@ -0,0 +1,34 @@
+#!/bin/sh
+# Pruebas de los programas traducidos: compila el compilador, traduce cada
+# programa de casos/, lo corre con su archivo .in como entrada y compara la
+# salida con su archivo .esperado. Termina con error si alguna prueba falla.
+#
+# Uso: ./pruebas.sh
+
+DIR=$(cd "$(dirname "$0")" && pwd)
+RAIZ=$(dirname "$DIR")
+
+TEMP=$(mktemp -d)
+trap 'rm -rf "$TEMP"' EXIT
+
+gcc -O2 -w "$RAIZ"/Compilador/*.c -o "$TEMP/wwe" -pthread || exit 1
+cp "$RAIZ/Ejemplos/Listas.c" "$RAIZ/Ejemplos/Listas.h" "$TEMP/"
+
+FALLAS=0
+for PROGRAMA in "$DIR"/casos/*.wwe; do
+    NOMBRE=$(basename "$PROGRAMA" .wwe)
+    cp "$PROGRAMA" "$TEMP/"
+    ENTRADA="$DIR/casos/$NOMBRE.in"
+    [ -f "$ENTRADA" ] || ENTRADA=/dev/null
+
+    if (cd "$TEMP" && ./wwe "$NOMBRE.wwe" -o "$NOMBRE") &&
+        "$TEMP/$NOMBRE" < "$ENTRADA" > "$TEMP/$NOMBRE.out" &&
+        cmp -s "$TEMP/$NOMBRE.out" "$DIR/casos/$NOMBRE.esperado"; then
+        echo "ok    $NOMBRE"
+    else
+        echo "falla $NOMBRE"
+        FALLAS=$((FALLAS + 1))
+    fi
+done
+
+[ $FALLAS -eq 0 ]